@@ -0,0 +1,67 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/* Bump allocator that hands out memory from large blocks. Memory is never freed individually,
+ * all blocks are released at once when the arena is destroyed. */
+class Arena final {
+private:
+    static constexpr auto block_size = std::size_t{ 64 * 1024 };
+
+    std::vector<std::unique_ptr<std::byte[]>> m_blocks;
+    std::byte* m_current{ nullptr };
+    std::size_t m_remaining{ 0 };
+
+public:
+    Arena() = default;
+    Arena(Arena const&) = delete;
+    Arena& operator=(Arena const&) = delete;
+
+    [[nodiscard]] void* allocate(std::size_t const size, std::size_t const alignment) {
+        assert(alignment <= alignof(std::max_align_t));
+        auto const padding = (alignment - reinterpret_cast<std::uintptr_t>(m_current) % alignment) % alignment;
+        if (m_current == nullptr or padding + size > m_remaining) {
+            // oversized allocations get a block of their own
+            auto const new_block_size = std::max(block_size, size);
+            m_blocks.push_back(std::make_unique_for_overwrite<std::byte[]>(new_block_size));
+            m_current = m_blocks.back().get();
+            m_remaining = new_block_size;
+            return bump(size);
+        }
+        m_current += padding;
+        m_remaining -= padding;
+        return bump(size);
+    }
+
+private:
+    [[nodiscard]] void* bump(std::size_t const size) {
+        auto const result = m_current;
+        m_current += size;
+        m_remaining -= size;
+        return result;
+    }
+};
+
+/* Base class for the nodes of the abstract syntax tree. Nodes can only be created inside of an
+ * arena (`new (arena) Node{ ... }`). Deleting a node only runs its destructor, the memory itself
+ * is owned by the arena. */
+class ArenaAllocated {
+public:
+    [[nodiscard]] static void* operator new(std::size_t const size, Arena& arena) {
+        return arena.allocate(size, alignof(std::max_align_t));
+    }
+
+    // only called if a constructor throws
+    static void operator delete(void*, Arena&) noexcept { }
+
+    static void operator delete(void*) noexcept { }
+
+protected:
+    ArenaAllocated() = default;
+    ~ArenaAllocated() = default;
+};
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <cassert>
 #include <string_view>
 
@@ -10,6 +11,18 @@ enum class BuiltinFunctionType {
     Write,
     Read,
     Trim,
+    Push,
+    Pop,
+    Reserve,
+    Capacity,
+};
+
+// all builtin functions in the order in which they are defined inside the global scope
+inline constexpr auto builtin_function_types = std::array{
+    BuiltinFunctionType::Split, BuiltinFunctionType::Join,    BuiltinFunctionType::Delete,
+    BuiltinFunctionType::Write, BuiltinFunctionType::Read,    BuiltinFunctionType::Trim,
+    BuiltinFunctionType::Push,  BuiltinFunctionType::Pop,     BuiltinFunctionType::Reserve,
+    BuiltinFunctionType::Capacity,
 };
 
 [[nodiscard]] constexpr std::string_view to_view(BuiltinFunctionType const type) {
@@ -26,6 +39,14 @@ enum class BuiltinFunctionType {
             return "read";
         case BuiltinFunctionType::Trim:
             return "trim";
+        case BuiltinFunctionType::Push:
+            return "push";
+        case BuiltinFunctionType::Pop:
+            return "pop";
+        case BuiltinFunctionType::Reserve:
+            return "reserve";
+        case BuiltinFunctionType::Capacity:
+            return "capacity";
     }
     assert(false and "unreachable");
     return "";
@@ -0,0 +1,135 @@
+#include "compiler.hpp"
+#include <cassert>
+#include <limits>
+#include <utility>
+#include <stdexcept>
+
+namespace bytecode {
+    [[nodiscard]] Program Compiler::compile(statements::Statements const& statements) {
+        auto compiler = Compiler{};
+        for (auto const& statement : statements) {
+            statement->compile(compiler);
+        }
+        compiler.emit(OpCode::Halt);
+
+        while (not compiler.m_pending_function_bodies.empty()) {
+            auto const body = compiler.m_pending_function_bodies.front();
+            compiler.m_pending_function_bodies.pop_front();
+            compiler.compile_function_body(*body);
+        }
+        return std::move(compiler.m_program);
+    }
+
+    std::size_t Compiler::emit(OpCode const op_code, std::uint32_t const operand, SourceLocation const& source_location) {
+        m_program.instructions.push_back(Instruction{ op_code, operand });
+        m_program.source_locations.push_back(source_location);
+        return m_program.instructions.size() - 1;
+    }
+
+    void Compiler::emit_constant(values::Value value) {
+        m_program.constants.push_back(std::move(value));
+        emit(OpCode::PushConstant, to_operand(m_program.constants.size() - 1));
+    }
+
+    void Compiler::patch_jump(std::size_t const jump_instruction, std::size_t const target) {
+        assert(m_program.instructions.at(jump_instruction).op_code == OpCode::Jump
+               or m_program.instructions.at(jump_instruction).op_code == OpCode::JumpIfFalse
+               or m_program.instructions.at(jump_instruction).op_code == OpCode::IteratorNext);
+        m_program.instructions.at(jump_instruction).operand = to_operand(target);
+    }
+
+    [[nodiscard]] std::uint32_t Compiler::add_token(Token const& token, Address const address) {
+        m_program.tokens.push_back(token);
+        m_program.addresses.push_back(address);
+        return to_operand(m_program.tokens.size() - 1);
+    }
+
+    [[nodiscard]] std::uint32_t Compiler::add_type(types::Type type) {
+        m_program.types.push_back(std::move(type));
+        return to_operand(m_program.types.size() - 1);
+    }
+
+    [[nodiscard]] std::uint32_t Compiler::add_statement(statements::Statement const& statement) {
+        m_program.statements.push_back(&statement);
+        return to_operand(m_program.statements.size() - 1);
+    }
+
+    [[nodiscard]] std::uint32_t Compiler::add_expression(expressions::Expression const& expression) {
+        m_program.expressions.push_back(&expression);
+        return to_operand(m_program.expressions.size() - 1);
+    }
+
+    void Compiler::enqueue_function_body(statements::Statement const& body) {
+        m_pending_function_bodies.push_back(&body);
+    }
+
+    void Compiler::push_scope() {
+        emit(OpCode::PushScope);
+        ++m_scope_depth;
+    }
+
+    void Compiler::pop_scope() {
+        assert(m_scope_depth > 1);
+        --m_scope_depth;
+        emit(OpCode::Truncate, to_operand(m_scope_depth));
+    }
+
+    [[nodiscard]] std::size_t Compiler::begin_loop() {
+        auto const index = to_operand(m_program.loops.size());
+        emit(OpCode::EnterLoop, index);
+        auto const continue_target = current_offset();
+        m_program.loops.push_back(LoopTargets{ continue_target, 0 });
+        m_loops.push_back(Loop{ index, m_scope_depth, continue_target, {} });
+        return continue_target;
+    }
+
+    [[nodiscard]] std::size_t Compiler::end_loop() {
+        assert(not m_loops.empty());
+        auto const break_target = emit(OpCode::ExitLoop);
+        for (auto const jump : m_loops.back().break_jumps) {
+            patch_jump(jump, break_target);
+        }
+        m_program.loops.at(m_loops.back().index).break_target = break_target;
+        m_loops.pop_back();
+        return break_target;
+    }
+
+    void Compiler::emit_break(Token const& break_token) {
+        if (m_loops.empty()) {
+            emit(OpCode::ThrowBreak, add_token(break_token));
+            return;
+        }
+        emit(OpCode::Truncate, to_operand(m_loops.back().scope_depth));
+        m_loops.back().break_jumps.push_back(emit(OpCode::Jump));
+    }
+
+    void Compiler::emit_continue(Token const& continue_token) {
+        if (m_loops.empty()) {
+            emit(OpCode::ThrowContinue, add_token(continue_token));
+            return;
+        }
+        emit(OpCode::Truncate, to_operand(m_loops.back().scope_depth));
+        emit(OpCode::Jump, to_operand(m_loops.back().continue_target));
+    }
+
+    void Compiler::compile_function_body(statements::Statement const& body) {
+        auto const old_scope_depth = std::exchange(m_scope_depth, 1); // the scope holding the parameters
+        auto const old_is_inside_function = std::exchange(m_is_inside_function, true);
+        auto old_loops = std::exchange(m_loops, {});
+
+        m_program.entry_points[&body] = current_offset();
+        body.compile(*this);
+        emit(OpCode::ReturnNothing);
+
+        m_loops = std::move(old_loops);
+        m_is_inside_function = old_is_inside_function;
+        m_scope_depth = old_scope_depth;
+    }
+
+    [[nodiscard]] std::uint32_t Compiler::to_operand(std::size_t const value) {
+        if (value > std::numeric_limits<std::uint32_t>::max()) {
+            throw std::runtime_error{ "program too large to be compiled into bytecode" };
+        }
+        return static_cast<std::uint32_t>(value);
+    }
+} // namespace bytecode
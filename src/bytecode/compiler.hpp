@@ -0,0 +1,74 @@
+#pragma once
+
+#include "../statements/statement.hpp"
+#include "program.hpp"
+#include <deque>
+#include <vector>
+
+namespace bytecode {
+    class Compiler final {
+    private:
+        struct Loop final {
+            std::uint32_t index; // into `Program::loops`
+            std::size_t scope_depth;
+            std::size_t continue_target;
+            std::vector<std::size_t> break_jumps;
+        };
+
+        Program m_program;
+        std::size_t m_scope_depth{ 1 }; // the global scope (or the function scope) is always present
+        bool m_is_inside_function{ false };
+        std::vector<Loop> m_loops;
+        std::deque<statements::Statement const*> m_pending_function_bodies;
+
+    public:
+        [[nodiscard]] static Program compile(statements::Statements const& statements);
+
+        std::size_t emit(OpCode op_code, std::uint32_t operand = 0, SourceLocation const& source_location = {});
+
+        void emit_constant(values::Value value);
+
+        [[nodiscard]] std::size_t current_offset() const {
+            return m_program.instructions.size();
+        }
+
+        void patch_jump(std::size_t jump_instruction, std::size_t target);
+
+        [[nodiscard]] std::uint32_t add_token(Token const& token, Address address = Address::dynamic());
+
+        [[nodiscard]] std::uint32_t add_type(types::Type type);
+
+        [[nodiscard]] std::uint32_t add_statement(statements::Statement const& statement);
+
+        [[nodiscard]] std::uint32_t add_expression(expressions::Expression const& expression);
+
+        void enqueue_function_body(statements::Statement const& body);
+
+        [[nodiscard]] bool is_inside_function() const {
+            return m_is_inside_function;
+        }
+
+        [[nodiscard]] std::size_t scope_depth() const {
+            return m_scope_depth;
+        }
+
+        void push_scope();
+
+        void pop_scope();
+
+        // emits `EnterLoop` and returns the start of the loop (the target of `continue`)
+        [[nodiscard]] std::size_t begin_loop();
+
+        // emits `ExitLoop` and returns its offset (the target of `break`)
+        [[nodiscard]] std::size_t end_loop();
+
+        void emit_break(Token const& break_token);
+
+        void emit_continue(Token const& continue_token);
+
+    private:
+        void compile_function_body(statements::Statement const& body);
+
+        [[nodiscard]] static std::uint32_t to_operand(std::size_t value);
+    };
+} // namespace bytecode
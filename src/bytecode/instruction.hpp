@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+
+namespace bytecode {
+    enum class OpCode : std::uint8_t {
+        PushConstant,
+        PushNothing,
+        ParseInteger,
+        LoadName,
+        Pop,
+        Swap,
+        UnaryPlus,
+        UnaryMinus,
+        Add,
+        Subtract,
+        Multiply,
+        Divide,
+        Mod,
+        Equals,
+        NotEquals,
+        LessThan,
+        LessOrEqual,
+        GreaterThan,
+        GreaterOrEqual,
+        LogicalAnd,
+        LogicalOr,
+        MakeRange,
+        MakeArray,
+        MakeStruct,
+        Subscript,
+        MemberAccess,
+        LoadSubscript, // like `Subscript` and `MemberAccess`, but pushes an rvalue (see `Expression::load()`)
+        LoadMember,
+        Cast,
+        TypeOf,
+        Call,
+        Assign,
+        AddAssign,
+        DefineVariable,
+        BindLoopVariable,
+        Execute,
+        Print,
+        Println,
+        PrintNewline,
+        Assert,
+        Jump,
+        JumpIfFalse,
+        PushScope,
+        Truncate,
+        Iterator,
+        IteratorNext,
+        EnterLoop,
+        ExitLoop,
+        Return,
+        ReturnNothing,
+        ThrowBreak,
+        ThrowContinue,
+        ThrowReturn,
+        Halt,
+    };
+
+    struct Instruction final {
+        OpCode op_code;
+        std::uint32_t operand;
+    };
+} // namespace bytecode
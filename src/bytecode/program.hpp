@@ -0,0 +1,42 @@
+#pragma once
+
+#include "../scope.hpp"
+#include "../source_location.hpp"
+#include "../token.hpp"
+#include "../types.hpp"
+#include "../values/value.hpp"
+#include "instruction.hpp"
+#include <unordered_map>
+#include <vector>
+
+namespace expressions {
+    class Expression;
+}
+
+namespace statements {
+    class Statement;
+}
+
+namespace bytecode {
+    // where a `break` or `continue` inside of a called function continues (see `OpCode::EnterLoop`)
+    struct LoopTargets final {
+        std::size_t continue_target;
+        std::size_t break_target;
+    };
+
+    /* A program in its compiled form. All instructions live in one linear vector: the top level
+     * code comes first (terminated by `Halt`), followed by the bodies of all function definitions.
+     * Instruction operands index into the pools below. */
+    struct Program final {
+        std::vector<Instruction> instructions;
+        std::vector<SourceLocation> source_locations; // one entry per instruction, used for diagnostics
+        std::vector<values::Value> constants;
+        std::vector<Token> tokens;
+        std::vector<Address> addresses; // one entry per token, only meaningful for variable names
+        std::vector<types::Type> types;
+        std::vector<statements::Statement const*> statements;
+        std::vector<expressions::Expression const*> expressions;
+        std::vector<LoopTargets> loops;
+        std::unordered_map<statements::Statement const*, std::size_t> entry_points; // function body -> offset
+    };
+} // namespace bytecode
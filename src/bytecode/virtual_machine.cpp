@@ -0,0 +1,355 @@
+#include "virtual_machine.hpp"
+#include "../control_flow.hpp"
+#include "../expressions/array_literal.hpp"
+#include "../expressions/struct_literal.hpp"
+#include "../statements/statement.hpp"
+#include "../values/bool.hpp"
+#include "../values/counted_iteration.hpp"
+#include "../values/function.hpp"
+#include "../values/integer.hpp"
+#include "../values/iterator.hpp"
+#include "../values/nothing.hpp"
+#include "../values/string.hpp"
+#include <iostream>
+#include <optional>
+
+namespace bytecode {
+    void VirtualMachine::run() {
+        auto const& instructions = m_program.instructions;
+        auto instruction_pointer = std::size_t{ 0 };
+        while (true) {
+            auto const [op_code, operand] = instructions[instruction_pointer];
+            auto const current = instruction_pointer;
+            ++instruction_pointer;
+            switch (op_code) {
+                case OpCode::PushConstant:
+                    push(m_program.constants[operand]->clone());
+                    break;
+                case OpCode::PushNothing:
+                    push(values::Nothing::make(values::ValueCategory::Rvalue));
+                    break;
+                case OpCode::ParseInteger:
+                    push(values::Integer::make(
+                            m_program.tokens[operand].parse_integer(),
+                            values::ValueCategory::Rvalue
+                    ));
+                    break;
+                case OpCode::LoadName: {
+                    auto const variable = m_scope_stack.lookup(m_program.addresses[operand], m_program.tokens[operand].symbol);
+                    if (variable == nullptr) {
+                        throw UndefinedReference{ m_program.tokens[operand] };
+                    }
+                    push(*variable);
+                    break;
+                }
+                case OpCode::Pop:
+                    m_stack.pop_back();
+                    break;
+                case OpCode::Swap:
+                    std::swap(m_stack[m_stack.size() - 1], m_stack[m_stack.size() - 2]);
+                    break;
+                case OpCode::UnaryPlus:
+                    push(pop()->unary_plus());
+                    break;
+                case OpCode::UnaryMinus:
+                    push(pop()->unary_minus());
+                    break;
+                case OpCode::Add: {
+                    auto const rhs = pop();
+                    push(pop()->binary_plus(rhs));
+                    break;
+                }
+                case OpCode::Subtract: {
+                    auto const rhs = pop();
+                    push(pop()->binary_minus(rhs));
+                    break;
+                }
+                case OpCode::Multiply: {
+                    auto const rhs = pop();
+                    push(pop()->multiply(rhs));
+                    break;
+                }
+                case OpCode::Divide: {
+                    auto const rhs = pop();
+                    push(pop()->divide(rhs));
+                    break;
+                }
+                case OpCode::Mod: {
+                    auto const rhs = pop();
+                    push(pop()->mod(rhs));
+                    break;
+                }
+                case OpCode::Equals: {
+                    auto const rhs = pop();
+                    push(pop()->equals(rhs));
+                    break;
+                }
+                case OpCode::NotEquals: {
+                    auto const rhs = pop();
+                    push(pop()->not_equals(rhs));
+                    break;
+                }
+                case OpCode::LessThan: {
+                    auto const rhs = pop();
+                    push(pop()->less_than(rhs));
+                    break;
+                }
+                case OpCode::LessOrEqual: {
+                    auto const rhs = pop();
+                    push(pop()->less_or_equals(rhs));
+                    break;
+                }
+                case OpCode::GreaterThan: {
+                    auto const rhs = pop();
+                    push(pop()->greater_than(rhs));
+                    break;
+                }
+                case OpCode::GreaterOrEqual: {
+                    auto const rhs = pop();
+                    push(pop()->greater_or_equals(rhs));
+                    break;
+                }
+                case OpCode::LogicalAnd: {
+                    auto const rhs = pop();
+                    push(pop()->logical_and(rhs));
+                    break;
+                }
+                case OpCode::LogicalOr: {
+                    auto const rhs = pop();
+                    push(pop()->logical_or(rhs));
+                    break;
+                }
+                case OpCode::MakeRange: {
+                    auto const end = pop();
+                    push(pop()->range(end, operand != 0));
+                    break;
+                }
+                case OpCode::MakeArray: {
+                    auto const& literal = static_cast<expressions::ArrayLiteral const&>(
+                            *m_program.expressions[operand]
+                    );
+                    push(literal.make_array(pop(literal.num_elements())));
+                    break;
+                }
+                case OpCode::MakeStruct: {
+                    auto const& literal = static_cast<expressions::StructLiteral const&>(
+                            *m_program.expressions[operand]
+                    );
+                    push(literal.instantiate(m_scope_stack, pop(literal.num_initializers())));
+                    break;
+                }
+                case OpCode::Subscript: {
+                    auto const index = pop();
+                    push(pop()->subscript(index));
+                    break;
+                }
+                case OpCode::MemberAccess:
+                    push(pop()->member_access(m_program.tokens[operand]));
+                    break;
+                case OpCode::LoadSubscript: {
+                    auto const index = pop();
+                    auto const container = pop();
+                    push(container->is_array() ? container->as_array().load_subscript(index) : container->subscript(index));
+                    break;
+                }
+                case OpCode::LoadMember: {
+                    auto const object = pop();
+                    auto const& member = m_program.tokens[operand];
+                    push(object->is_struct() ? object->as_struct().load_member(member) : object->member_access(member));
+                    break;
+                }
+                case OpCode::Cast:
+                    push(pop()->cast(m_program.types[operand]));
+                    break;
+                case OpCode::TypeOf:
+                    push(values::String::make(pop()->type()->to_string(), values::ValueCategory::Rvalue));
+                    break;
+                case OpCode::Call: {
+                    auto const arguments = pop(operand);
+                    instruction_pointer = call(pop(), arguments, instruction_pointer);
+                    break;
+                }
+                case OpCode::Assign: {
+                    auto const value = pop();
+                    pop()->assign(value);
+                    break;
+                }
+                case OpCode::AddAssign: {
+                    auto const value = pop();
+                    pop()->add_assign(value);
+                    break;
+                }
+                case OpCode::DefineVariable: {
+                    auto value = pop()->as_rvalue();
+                    value->promote_to_lvalue();
+                    auto const inserted = m_scope_stack.insert(m_program.tokens[operand].symbol, std::move(value));
+                    if (not inserted) {
+                        throw SymbolRedefinition{ m_program.tokens[operand] };
+                    }
+                    break;
+                }
+                case OpCode::BindLoopVariable:
+                    m_scope_stack.append(m_program.tokens[operand].symbol, pop());
+                    break;
+                case OpCode::Execute:
+                    if (auto const completion = m_program.statements[operand]->execute(m_scope_stack);
+                        not completion.is_normal()) {
+                        completion.throw_unhandled();
+                    }
+                    break;
+                case OpCode::Print:
+                    std::cout << pop()->string_representation();
+                    break;
+                case OpCode::Println:
+                    std::cout << pop()->string_representation() << '\n';
+                    break;
+                case OpCode::PrintNewline:
+                    std::cout << '\n';
+                    break;
+                case OpCode::Assert: {
+                    auto const value = pop();
+                    auto const& source_location = m_program.source_locations[current];
+                    if (not value->is_bool_value()) {
+                        throw TypeMismatch{ source_location, types::make_bool(), value->type() };
+                    }
+                    if (not value->as_bool_value()) {
+                        throw FailedAssertion{ source_location };
+                    }
+                    break;
+                }
+                case OpCode::Jump:
+                    instruction_pointer = operand;
+                    break;
+                case OpCode::JumpIfFalse: {
+                    auto const condition = pop();
+                    if (not condition->is_bool_value()) {
+                        throw TypeMismatch{ m_program.source_locations[current], types::make_bool(), condition->type() };
+                    }
+                    if (not condition->as_bool_value()) {
+                        instruction_pointer = operand;
+                    }
+                    break;
+                }
+                case OpCode::PushScope:
+                    m_scope_stack.push();
+                    break;
+                case OpCode::Truncate:
+                    m_scope_stack.truncate(scope_base() + operand);
+                    break;
+                case OpCode::Iterator: {
+                    // counted iterations keep the index next to the iterable, other ones don't need it
+                    auto iterable = pop();
+                    if (values::supports_counted_iteration(iterable)) {
+                        push(std::move(iterable));
+                        push(values::Integer::make(0, values::ValueCategory::Rvalue));
+                    } else {
+                        push(iterable->iterator());
+                        push(values::Nothing::make(values::ValueCategory::Rvalue));
+                    }
+                    break;
+                }
+                case OpCode::IteratorNext: {
+                    assert(m_stack.size() >= 2);
+                    auto& index = m_stack.back();
+                    auto const& iterable = m_stack[m_stack.size() - 2];
+                    auto next = std::optional<values::Value>{};
+                    if (index->is_integer_value()) {
+                        auto const current_index = index->as_integer_value();
+                        next = values::counted_iteration_element(iterable, static_cast<std::size_t>(current_index));
+                        index = values::Integer::make(current_index + 1, values::ValueCategory::Rvalue);
+                    } else {
+                        assert(iterable->is_iterator());
+                        next = iterable->as_iterator().next();
+                    }
+                    if (next.has_value()) {
+                        push(std::move(*next));
+                    } else {
+                        instruction_pointer = operand;
+                    }
+                    break;
+                }
+                case OpCode::EnterLoop:
+                    m_active_loops.push_back(ActiveLoop{ operand, m_call_frames.size(), m_scope_stack.size(), m_stack.size() });
+                    break;
+                case OpCode::ExitLoop:
+                    m_active_loops.pop_back();
+                    break;
+                case OpCode::Return:
+                    instruction_pointer = return_from_function(pop()->clone());
+                    break;
+                case OpCode::ReturnNothing:
+                    instruction_pointer = return_from_function(values::Nothing::make(values::ValueCategory::Rvalue));
+                    break;
+                case OpCode::ThrowBreak:
+                    if (m_active_loops.empty()) {
+                        throw BreakException{ m_program.tokens[operand] };
+                    }
+                    instruction_pointer = unwind_to_active_loop().break_target;
+                    break;
+                case OpCode::ThrowContinue:
+                    if (m_active_loops.empty()) {
+                        throw ContinueException{ m_program.tokens[operand] };
+                    }
+                    instruction_pointer = unwind_to_active_loop().continue_target;
+                    break;
+                case OpCode::ThrowReturn:
+                    throw ReturnException{ m_program.tokens[operand] };
+                case OpCode::Halt:
+                    return;
+            }
+        }
+    }
+
+    [[nodiscard]] std::vector<values::Value> VirtualMachine::pop(std::size_t const count) {
+        assert(count <= m_stack.size());
+        auto const first = std::prev(m_stack.end(), static_cast<std::ptrdiff_t>(count));
+        auto result = std::vector<values::Value>{ std::make_move_iterator(first), std::make_move_iterator(m_stack.end()) };
+        m_stack.erase(first, m_stack.end());
+        return result;
+    }
+
+    [[nodiscard]] std::size_t VirtualMachine::call(
+            values::Value callee,
+            std::vector<values::Value> const& arguments,
+            std::size_t const return_address
+    ) {
+        if (not callee->is_function()) {
+            // builtin functions (or values that cannot be called at all)
+            push(callee->call(m_scope_stack, arguments));
+            return return_address;
+        }
+        auto const& function = callee->as_function();
+        auto const entry_point = m_program.entry_points.at(function.body());
+        auto const scope_base = m_scope_stack.size();
+        m_scope_stack.push();
+        function.bind_arguments(m_scope_stack, arguments);
+        m_call_frames.push_back(CallFrame{ return_address, scope_base, m_stack.size(), std::move(callee) });
+        return entry_point;
+    }
+
+    [[nodiscard]] std::size_t VirtualMachine::return_from_function(values::Value return_value) {
+        assert(not m_call_frames.empty());
+        auto const frame = std::move(m_call_frames.back());
+        m_call_frames.pop_back();
+        while (not m_active_loops.empty() and m_active_loops.back().call_depth > m_call_frames.size()) {
+            m_active_loops.pop_back();
+        }
+        frame.function->as_function().check_return_value(return_value);
+        m_scope_stack.truncate(frame.scope_base);
+        m_stack.resize(frame.stack_base);
+        push(std::move(return_value));
+        return frame.return_address;
+    }
+
+    /* `ThrowBreak` and `ThrowContinue` are only emitted outside of loops, so the innermost active loop
+     * belongs to a caller. All functions called from within that loop are left without a return value. */
+    [[nodiscard]] LoopTargets const& VirtualMachine::unwind_to_active_loop() {
+        assert(not m_active_loops.empty());
+        auto const& loop = m_active_loops.back();
+        assert(loop.call_depth < m_call_frames.size());
+        m_call_frames.erase(std::next(m_call_frames.begin(), static_cast<std::ptrdiff_t>(loop.call_depth)), m_call_frames.end());
+        m_scope_stack.truncate(loop.scope_size);
+        m_stack.resize(loop.stack_size);
+        return m_program.loops[loop.index];
+    }
+} // namespace bytecode
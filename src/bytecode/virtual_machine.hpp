@@ -0,0 +1,62 @@
+#pragma once
+
+#include "../scope.hpp"
+#include "program.hpp"
+#include <vector>
+
+namespace bytecode {
+    class VirtualMachine final {
+    private:
+        struct CallFrame final {
+            std::size_t return_address;
+            std::size_t scope_base;
+            std::size_t stack_base;
+            values::Value function;
+        };
+
+        // a loop that is currently running, recorded so that a called function can `break` out of it
+        struct ActiveLoop final {
+            std::uint32_t index; // into `Program::loops`
+            std::size_t call_depth;
+            std::size_t scope_size;
+            std::size_t stack_size;
+        };
+
+        Program const& m_program;
+        ScopeStack& m_scope_stack;
+        std::vector<values::Value> m_stack;
+        std::vector<CallFrame> m_call_frames;
+        std::vector<ActiveLoop> m_active_loops;
+
+    public:
+        VirtualMachine(Program const& program, ScopeStack& scope_stack)
+            : m_program{ program },
+              m_scope_stack{ scope_stack } { }
+
+        void run();
+
+    private:
+        [[nodiscard]] values::Value pop() {
+            assert(not m_stack.empty());
+            auto value = std::move(m_stack.back());
+            m_stack.pop_back();
+            return value;
+        }
+
+        [[nodiscard]] std::vector<values::Value> pop(std::size_t count);
+
+        void push(values::Value value) {
+            m_stack.push_back(std::move(value));
+        }
+
+        [[nodiscard]] std::size_t scope_base() const {
+            return m_call_frames.empty() ? 0 : m_call_frames.back().scope_base;
+        }
+
+        [[nodiscard]] std::size_t call(values::Value callee, std::vector<values::Value> const& arguments, std::size_t return_address);
+
+        [[nodiscard]] std::size_t return_from_function(values::Value return_value);
+
+        [[nodiscard]] LoopTargets const& unwind_to_active_loop();
+    };
+} // namespace bytecode
@@ -1,12 +1,17 @@
 #pragma once
 
+#include "scope.hpp"
 #include "token.hpp"
 #include "values/value.hpp"
+#include <cassert>
+#include <concepts>
+#include <cstdint>
 #include <format>
 #include <optional>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <utility>
 
 class ControlFlowException : public std::exception {
 private:
@@ -22,34 +27,127 @@ public:
 };
 
 class BreakException final : public ControlFlowException {
+private:
+    Token const* m_break_token;
+
 public:
-    explicit BreakException(Token const break_token)
-        : ControlFlowException{ std::format("{}: usage of 'break' outside of loop", break_token.source_location) } { }
+    explicit BreakException(Token const& break_token)
+        : ControlFlowException{ std::format("{}: usage of 'break' outside of loop", break_token.source_location()) },
+          m_break_token{ &break_token } { }
+
+    [[nodiscard]] Token const& token() const {
+        return *m_break_token;
+    }
 };
 
 class ContinueException final : public ControlFlowException {
+private:
+    Token const* m_continue_token;
+
 public:
-    explicit ContinueException(Token const continue_token)
+    explicit ContinueException(Token const& continue_token)
         : ControlFlowException{
-              std::format("{}: usage of 'continue' outside of loop", continue_token.source_location)
-          } { }
+              std::format("{}: usage of 'continue' outside of loop", continue_token.source_location())
+          },
+          m_continue_token{ &continue_token } { }
+
+    [[nodiscard]] Token const& token() const {
+        return *m_continue_token;
+    }
 };
 
 class ReturnException final : public ControlFlowException {
+public:
+    explicit ReturnException(Token const return_token)
+        : ControlFlowException{ std::format("{}: return statement outside of function", return_token.source_location()) } {
+    }
+};
+
+/* The result of executing a statement. Any completion that is not `Normal` is handed outwards by
+ * the enclosing statements until it reaches the loop (`Break`, `Continue`) or the function call
+ * (`Return`) that consumes it. Only if there is no such construct, it gets turned into one of
+ * the exceptions above. A `break` or `continue` that leaves a function body ends the loop the
+ * function has been called from (see `execute_loop_body()`). */
+class Completion final {
+public:
+    enum class Kind : std::uint8_t {
+        Normal,
+        Break,
+        Continue,
+        Return,
+    };
+
 private:
+    Kind m_kind;
+    Token const* m_token; // the keyword that caused this completion (`nullptr` for `Normal`)
     std::optional<values::Value> m_value;
 
-    ReturnException(Token const return_token, std::optional<values::Value> value)
-        : ControlFlowException{ std::format("{}: return statement outside of function", return_token.source_location) },
+    Completion(Kind const kind, Token const* const token, std::optional<values::Value> value)
+        : m_kind{ kind },
+          m_token{ token },
           m_value{ std::move(value) } { }
 
 public:
-    ReturnException(Token const return_token, values::Value value)
-        : ReturnException{ return_token, std::optional<values::Value>{ std::move(value) } } { }
+    [[nodiscard]] static Completion normal() {
+        return Completion{ Kind::Normal, nullptr, std::nullopt };
+    }
+
+    [[nodiscard]] static Completion break_(Token const& break_token) {
+        return Completion{ Kind::Break, &break_token, std::nullopt };
+    }
+
+    [[nodiscard]] static Completion continue_(Token const& continue_token) {
+        return Completion{ Kind::Continue, &continue_token, std::nullopt };
+    }
+
+    [[nodiscard]] static Completion return_(Token const& return_token, std::optional<values::Value> value) {
+        return Completion{ Kind::Return, &return_token, std::move(value) };
+    }
 
-    explicit ReturnException(Token const return_token) : ReturnException{ return_token, std::nullopt } { }
+    [[nodiscard]] Kind kind() const {
+        return m_kind;
+    }
+
+    [[nodiscard]] bool is_normal() const {
+        return m_kind == Kind::Normal;
+    }
 
-    [[nodiscard]] std::optional<values::Value> value() const {
-        return m_value.and_then([](auto const& value) { return std::optional{ value->clone() }; });
+    // only valid for `Return` completions
+    [[nodiscard]] std::optional<values::Value> const& value() const {
+        assert(m_kind == Kind::Return);
+        return m_value;
+    }
+
+    // reports a `break`, `continue` or `return` that was used outside of its construct
+    [[noreturn]] void throw_unhandled() const {
+        assert(m_token != nullptr);
+        switch (m_kind) {
+            case Kind::Break:
+                throw BreakException{ *m_token };
+            case Kind::Continue:
+                throw ContinueException{ *m_token };
+            case Kind::Return:
+            case Kind::Normal:
+                break;
+        }
+        assert(m_kind == Kind::Return);
+        throw ReturnException{ *m_token };
     }
 };
+
+/* Runs one iteration of a loop body. `break` and `continue` statements inside of a function that
+ * has been called from the body leave the function as exceptions (expressions cannot hand on a
+ * completion) and are turned back into completions for the loop here. */
+template<std::invocable Body>
+[[nodiscard]] Completion execute_loop_body(ScopeStack& scope_stack, Body&& body) {
+    auto const num_scopes = scope_stack.size();
+    try {
+        return std::forward<Body>(body)();
+    } catch (BreakException const& exception) {
+        scope_stack.truncate(num_scopes);
+        return Completion::break_(exception.token());
+    } catch (ContinueException const& exception) {
+        scope_stack.truncate(num_scopes);
+        return Completion::continue_(exception.token());
+    }
+}
@@ -1,5 +1,9 @@
 #pragma once
 
+#include "../bytecode/compiler.hpp"
+#include "../optimizer.hpp"
+#include "../program_image.hpp"
+#include "../resolver.hpp"
 #include "../values/array.hpp"
 #include "expression.hpp"
 
@@ -24,34 +28,67 @@ namespace expressions {
             auto elements = std::vector<values::Value>{};
             elements.reserve(m_values.size());
             for (auto const& value : m_values) {
-                auto evaluated = value->evaluate(scope_stack);
-                if (evaluated->is_lvalue()) {
-                    evaluated = evaluated->clone();
-                } else {
-                    evaluated->promote_to_lvalue();
-                }
-                elements.push_back(std::move(evaluated));
+                elements.push_back(value->load(scope_stack));
+            }
+            return make_array(std::move(elements));
+        }
+
+        void compile(bytecode::Compiler& compiler) const override {
+            for (auto const& value : m_values) {
+                value->compile_load(compiler);
             }
+            compiler.emit(bytecode::OpCode::MakeArray, compiler.add_expression(*this));
+        }
 
-            if (not elements.empty()) {
-                for (std::size_t i = 1; i < elements.size(); ++i) {
-                    if (elements.at(i)->type() != elements.front()->type()) {
+        void resolve(Resolver& resolver) override {
+            for (auto const& value : m_values) {
+                value->resolve(resolver);
+            }
+        }
+
+        [[nodiscard]] std::unique_ptr<Expression> optimize(Optimizer& optimizer) override {
+            for (auto& value : m_values) {
+                optimizer.optimize(value);
+            }
+            return nullptr;
+        }
+
+        void serialize(ImageWriter& writer) const override {
+            writer.write_tag(NodeTag::ArrayLiteral);
+            writer.write_token(m_opening_bracket);
+            writer.write_expressions(m_values);
+            writer.write_token(m_closing_bracket);
+        }
+
+        [[nodiscard]] static std::unique_ptr<Expression> deserialize(ImageReader& reader) {
+            auto const opening_bracket = reader.read_token();
+            auto values = reader.read_expressions();
+            auto const closing_bracket = reader.read_token();
+            return reader.make<ArrayLiteral>(opening_bracket, std::move(values), closing_bracket);
+        }
+
+        [[nodiscard]] std::size_t num_elements() const {
+            return m_values.size();
+        }
+
+        // creates the array from the already evaluated element values
+        [[nodiscard]] values::Value make_array(std::vector<values::Value> evaluated_values) const {
+            assert(evaluated_values.size() == m_values.size());
+            if (not evaluated_values.empty()) {
+                for (std::size_t i = 1; i < evaluated_values.size(); ++i) {
+                    if (evaluated_values.at(i)->type() != evaluated_values.front()->type()) {
                         throw TypeMismatch{ m_values.at(i)->source_location(),
-                                            elements.front()->type(),
-                                            elements.at(i)->type() };
+                                            evaluated_values.front()->type(),
+                                            evaluated_values.at(i)->type() };
                     }
                 }
             }
 
-            for ([[maybe_unused]] auto const& element : elements) {
-                assert(element->is_lvalue());
-            }
-
-            return values::Array::make(std::move(elements), values::ValueCategory::Rvalue);
+            return values::Array::make(std::move(evaluated_values), values::ValueCategory::Rvalue);
         }
 
         [[nodiscard]] SourceLocation source_location() const override {
-            return SourceLocation::from_range(m_opening_bracket.source_location, m_closing_bracket.source_location);
+            return SourceLocation::from_range(m_opening_bracket.source_location(), m_closing_bracket.source_location());
         }
     };
 } // namespace expressions
@@ -1,6 +1,13 @@
 #pragma once
 
+#include "../bytecode/compiler.hpp"
+#include "../optimizer.hpp"
+#include "../program_image.hpp"
+#include "../resolver.hpp"
+#include "../values/integer.hpp"
 #include "expression.hpp"
+#include <cstdint>
+#include <limits>
 
 namespace expressions {
     class BinaryOperator final : public Expression {
@@ -22,9 +29,20 @@ namespace expressions {
         };
 
     private:
+        /* Chosen by the operand types seen during the first evaluation. While the operands keep
+         * these types, the operation is computed directly instead of dispatching through `Value`.
+         * After the first mismatch, the operator stays generic. */
+        enum class Specialization : std::uint8_t {
+            Unknown,
+            Integers,
+            Bools,
+            Generic,
+        };
+
         std::unique_ptr<Expression> m_left;
         Kind m_kind;
         std::unique_ptr<Expression> m_right;
+        mutable Specialization m_specialization{ Specialization::Unknown };
 
     public:
         BinaryOperator(std::unique_ptr<Expression> left, Kind const kind, std::unique_ptr<Expression> right)
@@ -33,41 +51,258 @@ namespace expressions {
               m_right{ std::move(right) } { }
 
         [[nodiscard]] values::Value evaluate(ScopeStack& scope_stack) const override {
+            auto const left = m_left->load(scope_stack);
+            auto const right = m_right->load(scope_stack);
+            if (m_specialization == Specialization::Unknown) {
+                m_specialization = specialization_for(left, right);
+            }
+            switch (m_specialization) {
+                case Specialization::Integers:
+                    if (left->is_integer_value() and right->is_integer_value()) {
+                        return apply_to_integers(left->as_integer_value(), right->as_integer_value());
+                    }
+                    m_specialization = Specialization::Generic;
+                    break;
+                case Specialization::Bools:
+                    if (left->is_bool_value() and right->is_bool_value()) {
+                        return apply_to_bools(left->as_bool_value(), right->as_bool_value());
+                    }
+                    m_specialization = Specialization::Generic;
+                    break;
+                case Specialization::Unknown:
+                case Specialization::Generic:
+                    break;
+            }
+            return apply(left, right);
+        }
+
+        void compile(bytecode::Compiler& compiler) const override {
+            m_left->compile_load(compiler);
+            m_right->compile_load(compiler);
             switch (m_kind) {
                 case Kind::Plus:
-                    return m_left->evaluate(scope_stack)->binary_plus(m_right->evaluate(scope_stack));
+                    compiler.emit(bytecode::OpCode::Add);
+                    break;
                 case Kind::Minus:
-                    return m_left->evaluate(scope_stack)->binary_minus(m_right->evaluate(scope_stack));
+                    compiler.emit(bytecode::OpCode::Subtract);
+                    break;
                 case Kind::Equality:
-                    return m_left->evaluate(scope_stack)->equals(m_right->evaluate(scope_stack));
+                    compiler.emit(bytecode::OpCode::Equals);
+                    break;
                 case Kind::Inequality:
-                    return m_left->evaluate(scope_stack)->not_equals(m_right->evaluate(scope_stack));
+                    compiler.emit(bytecode::OpCode::NotEquals);
+                    break;
                 case Kind::LessThan:
-                    return m_left->evaluate(scope_stack)->less_than(m_right->evaluate(scope_stack));
+                    compiler.emit(bytecode::OpCode::LessThan);
+                    break;
                 case Kind::LessOrEqual:
-                    return m_left->evaluate(scope_stack)->less_or_equals(m_right->evaluate(scope_stack));
+                    compiler.emit(bytecode::OpCode::LessOrEqual);
+                    break;
                 case Kind::GreaterThan:
-                    return m_left->evaluate(scope_stack)->greater_than(m_right->evaluate(scope_stack));
+                    compiler.emit(bytecode::OpCode::GreaterThan);
+                    break;
                 case Kind::GreaterOrEqual:
-                    return m_left->evaluate(scope_stack)->greater_or_equals(m_right->evaluate(scope_stack));
+                    compiler.emit(bytecode::OpCode::GreaterOrEqual);
+                    break;
                 case Kind::And:
-                    return m_left->evaluate(scope_stack)->logical_and(m_right->evaluate(scope_stack));
+                    compiler.emit(bytecode::OpCode::LogicalAnd);
+                    break;
                 case Kind::Or:
-                    return m_left->evaluate(scope_stack)->logical_or(m_right->evaluate(scope_stack));
+                    compiler.emit(bytecode::OpCode::LogicalOr);
+                    break;
                 case Kind::Mod:
-                    return m_left->evaluate(scope_stack)->mod(m_right->evaluate(scope_stack));
+                    compiler.emit(bytecode::OpCode::Mod);
+                    break;
                 case Kind::Multiply:
-                    return m_left->evaluate(scope_stack)->multiply(m_right->evaluate(scope_stack));
+                    compiler.emit(bytecode::OpCode::Multiply);
+                    break;
                 case Kind::Divide:
-                    return m_left->evaluate(scope_stack)->divide(m_right->evaluate(scope_stack));
+                    compiler.emit(bytecode::OpCode::Divide);
+                    break;
                 default:
                     assert(false and "unreachable");
-                    return {};
+                    break;
+            }
+        }
+
+        void resolve(Resolver& resolver) override {
+            m_left->resolve(resolver);
+            m_right->resolve(resolver);
+        }
+
+        [[nodiscard]] std::unique_ptr<Expression> optimize(Optimizer& optimizer) override {
+            optimizer.optimize(m_left);
+            optimizer.optimize(m_right);
+            auto const left = m_left->constant_value();
+            auto const right = m_right->constant_value();
+            if (not left.has_value() or not right.has_value() or not can_be_folded(left.value(), right.value())) {
+                return nullptr;
             }
+            return optimizer.fold(source_location(), [&] { return apply(left.value(), right.value()); });
+        }
+
+        void serialize(ImageWriter& writer) const override {
+            writer.write_tag(NodeTag::BinaryOperator);
+            writer.write_expression(*m_left);
+            writer.write_enum(m_kind);
+            writer.write_expression(*m_right);
+        }
+
+        [[nodiscard]] static std::unique_ptr<Expression> deserialize(ImageReader& reader) {
+            auto left = reader.read_expression();
+            auto const kind = reader.read_enum(Kind::Divide);
+            auto right = reader.read_expression();
+            return reader.make<BinaryOperator>(std::move(left), kind, std::move(right));
         }
 
         [[nodiscard]] SourceLocation source_location() const override {
             return SourceLocation::from_range(m_left->source_location(), m_right->source_location());
         }
+
+    private:
+        [[nodiscard]] Specialization specialization_for(values::Value const& left, values::Value const& right) const {
+            if (left->is_integer_value() and right->is_integer_value()) {
+                return (m_kind == Kind::And or m_kind == Kind::Or) ? Specialization::Generic : Specialization::Integers;
+            }
+            if (left->is_bool_value() and right->is_bool_value()) {
+                switch (m_kind) {
+                    case Kind::Equality:
+                    case Kind::Inequality:
+                    case Kind::And:
+                    case Kind::Or:
+                        return Specialization::Bools;
+                    default:
+                        return Specialization::Generic;
+                }
+            }
+            return Specialization::Generic;
+        }
+
+        /* Integer operations that overflow or trap (division by zero, `INT_MIN / -1`) are left for the
+         * runtime. Evaluating them here would be undefined behavior (or kill the process) even if the
+         * operation is never executed. The same goes for string repetitions whose result would be
+         * large: they would be built at compile time (and stored in cached images) even in dead code. */
+        [[nodiscard]] bool can_be_folded(values::Value const& left, values::Value const& right) const {
+            if (m_kind == Kind::Multiply and left->is_string_value() and right->is_integer_value()) {
+                return is_small_repetition(left->as_string(), right->as_integer_value());
+            }
+            if (m_kind == Kind::Multiply and left->is_integer_value() and right->is_string_value()) {
+                return is_small_repetition(right->as_string(), left->as_integer_value());
+            }
+            if (not left->is_integer_value() or not right->is_integer_value()) {
+                return true;
+            }
+            auto const lhs = std::int64_t{ left->as_integer_value() };
+            auto const rhs = std::int64_t{ right->as_integer_value() };
+            auto const fits = [](std::int64_t const result) {
+                return result >= std::numeric_limits<std::int32_t>::min()
+                       and result <= std::numeric_limits<std::int32_t>::max();
+            };
+            switch (m_kind) {
+                case Kind::Plus:
+                    return fits(lhs + rhs);
+                case Kind::Minus:
+                    return fits(lhs - rhs);
+                case Kind::Multiply:
+                    return fits(lhs * rhs);
+                case Kind::Divide:
+                case Kind::Mod:
+                    return rhs != 0 and fits(lhs / rhs);
+                default:
+                    return true;
+            }
+        }
+
+        [[nodiscard]] static bool is_small_repetition(values::String const& string, std::int32_t const count) {
+            static constexpr auto max_folded_length = std::int64_t{ 1024 };
+            return std::int64_t{ count } * static_cast<std::int64_t>(string.length()) <= max_folded_length;
+        }
+
+        // has to behave exactly like the operations of `values::Integer`
+        [[nodiscard]] values::Value apply_to_integers(std::int32_t const left, std::int32_t const right) const {
+            using values::Bool, values::Integer, values::ValueCategory;
+            switch (m_kind) {
+                case Kind::Plus:
+                    return Integer::make(left + right, ValueCategory::Rvalue);
+                case Kind::Minus:
+                    return Integer::make(left - right, ValueCategory::Rvalue);
+                case Kind::Multiply:
+                    return Integer::make(left * right, ValueCategory::Rvalue);
+                case Kind::Divide:
+                    if (right == 0) {
+                        throw DivisionByZero{};
+                    }
+                    return Integer::make(left / right, ValueCategory::Rvalue);
+                case Kind::Mod:
+                    return Integer::make(left % right, ValueCategory::Rvalue);
+                case Kind::Equality:
+                    return Bool::make(left == right, ValueCategory::Rvalue);
+                case Kind::Inequality:
+                    return Bool::make(left != right, ValueCategory::Rvalue);
+                case Kind::LessThan:
+                    return Bool::make(left < right, ValueCategory::Rvalue);
+                case Kind::LessOrEqual:
+                    return Bool::make(left <= right, ValueCategory::Rvalue);
+                case Kind::GreaterThan:
+                    return Bool::make(left > right, ValueCategory::Rvalue);
+                case Kind::GreaterOrEqual:
+                    return Bool::make(left >= right, ValueCategory::Rvalue);
+                default:
+                    assert(false and "unreachable");
+                    return {};
+            }
+        }
+
+        // has to behave exactly like the operations of `values::Bool`
+        [[nodiscard]] values::Value apply_to_bools(bool const left, bool const right) const {
+            using values::Bool, values::ValueCategory;
+            switch (m_kind) {
+                case Kind::Equality:
+                    return Bool::make(left == right, ValueCategory::Rvalue);
+                case Kind::Inequality:
+                    return Bool::make(left != right, ValueCategory::Rvalue);
+                case Kind::And:
+                    return Bool::make(left and right, ValueCategory::Rvalue);
+                case Kind::Or:
+                    return Bool::make(left or right, ValueCategory::Rvalue);
+                default:
+                    assert(false and "unreachable");
+                    return {};
+            }
+        }
+
+        [[nodiscard]] values::Value apply(values::Value const& left, values::Value const& right) const {
+            switch (m_kind) {
+                case Kind::Plus:
+                    return left->binary_plus(right);
+                case Kind::Minus:
+                    return left->binary_minus(right);
+                case Kind::Equality:
+                    return left->equals(right);
+                case Kind::Inequality:
+                    return left->not_equals(right);
+                case Kind::LessThan:
+                    return left->less_than(right);
+                case Kind::LessOrEqual:
+                    return left->less_or_equals(right);
+                case Kind::GreaterThan:
+                    return left->greater_than(right);
+                case Kind::GreaterOrEqual:
+                    return left->greater_or_equals(right);
+                case Kind::And:
+                    return left->logical_and(right);
+                case Kind::Or:
+                    return left->logical_or(right);
+                case Kind::Mod:
+                    return left->mod(right);
+                case Kind::Multiply:
+                    return left->multiply(right);
+                case Kind::Divide:
+                    return left->divide(right);
+                default:
+                    assert(false and "unreachable");
+                    return {};
+            }
+        }
     };
 }
\ No newline at end of file
@@ -1,5 +1,9 @@
 #pragma once
 
+#include "../bytecode/compiler.hpp"
+#include "../optimizer.hpp"
+#include "../program_image.hpp"
+#include "../resolver.hpp"
 #include "expression.hpp"
 #include "../values/bool.hpp"
 
@@ -11,7 +15,39 @@ namespace expressions {
     public:
         explicit BoolLiteral(Token token) : m_token{ token } { }
 
-        [[nodiscard]] values::Value evaluate(ScopeStack& scope_stack) const override {
+        [[nodiscard]] values::Value evaluate([[maybe_unused]] ScopeStack& scope_stack) const override {
+            return value();
+        }
+
+        void compile(bytecode::Compiler& compiler) const override {
+            compiler.emit_constant(value());
+        }
+
+        void resolve([[maybe_unused]] Resolver& resolver) override { }
+
+        [[nodiscard]] std::unique_ptr<Expression> optimize([[maybe_unused]] Optimizer& optimizer) override {
+            return nullptr;
+        }
+
+        void serialize(ImageWriter& writer) const override {
+            writer.write_tag(NodeTag::BoolLiteral);
+            writer.write_token(m_token);
+        }
+
+        [[nodiscard]] static std::unique_ptr<Expression> deserialize(ImageReader& reader) {
+            return reader.make<BoolLiteral>(reader.read_token());
+        }
+
+        [[nodiscard]] std::optional<values::Value> constant_value() const override {
+            return value();
+        }
+
+        [[nodiscard]] SourceLocation source_location() const override {
+            return m_token.source_location();
+        }
+
+    private:
+        [[nodiscard]] values::Value value() const {
             if (m_token.lexeme() == "true") {
                 return values::Bool::make(true, values::ValueCategory::Rvalue);
             } else if (m_token.lexeme() == "false") {
@@ -21,9 +57,5 @@ namespace expressions {
                 return {};
             }
         }
-
-        [[nodiscard]] SourceLocation source_location() const override {
-            return m_token.source_location;
-        }
     };
 }
\ No newline at end of file
@@ -1,5 +1,9 @@
 #pragma once
 
+#include "../bytecode/compiler.hpp"
+#include "../optimizer.hpp"
+#include "../program_image.hpp"
+#include "../resolver.hpp"
 #include "expression.hpp"
 
 namespace expressions {
@@ -21,11 +25,54 @@ namespace expressions {
               m_closing_parenthesis{ closing_parenthesis } { }
 
         [[nodiscard]] values::Value evaluate(ScopeStack& scope_stack) const override {
-            return m_callee->evaluate(scope_stack)->call(scope_stack, m_arguments);
+            auto const callee = m_callee->load(scope_stack);
+            auto arguments = std::vector<values::Value>{};
+            arguments.reserve(m_arguments.size());
+            for (auto const& argument : m_arguments) {
+                arguments.push_back(argument->evaluate(scope_stack));
+            }
+            return callee->call(scope_stack, arguments);
+        }
+
+        void compile(bytecode::Compiler& compiler) const override {
+            m_callee->compile_load(compiler);
+            for (auto const& argument : m_arguments) {
+                argument->compile(compiler);
+            }
+            compiler.emit(bytecode::OpCode::Call, static_cast<std::uint32_t>(m_arguments.size()));
+        }
+
+        void resolve(Resolver& resolver) override {
+            m_callee->resolve(resolver);
+            for (auto const& argument : m_arguments) {
+                argument->resolve(resolver);
+            }
+        }
+
+        [[nodiscard]] std::unique_ptr<Expression> optimize(Optimizer& optimizer) override {
+            optimizer.optimize(m_callee);
+            for (auto& argument : m_arguments) {
+                optimizer.optimize(argument);
+            }
+            return nullptr;
+        }
+
+        void serialize(ImageWriter& writer) const override {
+            writer.write_tag(NodeTag::Call);
+            writer.write_expression(*m_callee);
+            writer.write_expressions(m_arguments);
+            writer.write_token(m_closing_parenthesis);
+        }
+
+        [[nodiscard]] static std::unique_ptr<Expression> deserialize(ImageReader& reader) {
+            auto callee = reader.read_expression();
+            auto arguments = reader.read_expressions();
+            auto const closing_parenthesis = reader.read_token();
+            return reader.make<Call>(std::move(callee), std::move(arguments), closing_parenthesis);
         }
 
         [[nodiscard]] SourceLocation source_location() const override {
-            return SourceLocation::from_range(m_callee->source_location(), m_closing_parenthesis.source_location);
+            return SourceLocation::from_range(m_callee->source_location(), m_closing_parenthesis.source_location());
         }
     };
 
@@ -1,5 +1,9 @@
 #pragma once
 
+#include "../bytecode/compiler.hpp"
+#include "../optimizer.hpp"
+#include "../program_image.hpp"
+#include "../resolver.hpp"
 #include "expression.hpp"
 
 namespace expressions {
@@ -14,7 +18,33 @@ namespace expressions {
               m_target_type{ std::move(target_type) } { }
 
         [[nodiscard]] values::Value evaluate(ScopeStack& scope_stack) const override {
-            return m_expression->evaluate(scope_stack)->cast(m_target_type);
+            return m_expression->load(scope_stack)->cast(m_target_type);
+        }
+
+        void compile(bytecode::Compiler& compiler) const override {
+            m_expression->compile_load(compiler);
+            compiler.emit(bytecode::OpCode::Cast, compiler.add_type(m_target_type));
+        }
+
+        void resolve(Resolver& resolver) override {
+            m_expression->resolve(resolver);
+        }
+
+        [[nodiscard]] std::unique_ptr<Expression> optimize(Optimizer& optimizer) override {
+            optimizer.optimize(m_expression);
+            return nullptr;
+        }
+
+        void serialize(ImageWriter& writer) const override {
+            writer.write_tag(NodeTag::Cast);
+            writer.write_expression(*m_expression);
+            writer.write_type(m_target_type);
+        }
+
+        [[nodiscard]] static std::unique_ptr<Expression> deserialize(ImageReader& reader) {
+            auto expression = reader.read_expression();
+            auto const target_type = reader.read_type();
+            return reader.make<Cast>(std::move(expression), target_type);
         }
 
         [[nodiscard]] SourceLocation source_location() const override {
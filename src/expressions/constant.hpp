@@ -0,0 +1,55 @@
+#pragma once
+
+#include "../bytecode/compiler.hpp"
+#include "../optimizer.hpp"
+#include "../program_image.hpp"
+#include "../resolver.hpp"
+#include "expression.hpp"
+
+namespace expressions {
+    // the result of constant folding (see optimizer.hpp)
+    class Constant final : public Expression {
+    private:
+        values::Value m_value;
+        SourceLocation m_source_location;
+
+    public:
+        Constant(values::Value value, SourceLocation const& source_location)
+            : m_value{ std::move(value) },
+              m_source_location{ source_location } { }
+
+        [[nodiscard]] values::Value evaluate([[maybe_unused]] ScopeStack& scope_stack) const override {
+            return m_value->clone();
+        }
+
+        void compile(bytecode::Compiler& compiler) const override {
+            compiler.emit_constant(m_value);
+        }
+
+        void resolve([[maybe_unused]] Resolver& resolver) override { }
+
+        [[nodiscard]] std::unique_ptr<Expression> optimize([[maybe_unused]] Optimizer& optimizer) override {
+            return nullptr;
+        }
+
+        void serialize(ImageWriter& writer) const override {
+            writer.write_tag(NodeTag::Constant);
+            writer.write_value(m_value);
+            writer.write_source_location(m_source_location);
+        }
+
+        [[nodiscard]] static std::unique_ptr<Expression> deserialize(ImageReader& reader) {
+            auto value = reader.read_value();
+            auto const source_location = reader.read_source_location();
+            return reader.make<Constant>(std::move(value), source_location);
+        }
+
+        [[nodiscard]] std::optional<values::Value> constant_value() const override {
+            return m_value->clone();
+        }
+
+        [[nodiscard]] SourceLocation source_location() const override {
+            return m_source_location;
+        }
+    };
+} // namespace expressions
@@ -1,12 +1,25 @@
 #pragma once
 
+#include "../arena.hpp"
 #include "../scope.hpp"
 #include "../token.hpp"
 #include "../values/value.hpp"
+#include <memory>
+#include <optional>
 #include <variant>
 
+class Optimizer;
+class Resolver;
+
+class ImageWriter;
+class ImageReader;
+
+namespace bytecode {
+    class Compiler;
+}
+
 namespace expressions {
-    class Expression {
+    class Expression : public ArenaAllocated {
     protected:
         Expression() = default;
 
@@ -15,6 +28,35 @@ namespace expressions {
 
         [[nodiscard]] virtual values::Value evaluate(ScopeStack& scope_stack) const = 0;
 
+        /* Evaluates the expression for reading only: the result is never modified or bound to a
+         * parameter. This allows array elements and struct members to be read without detaching
+         * their (copy-on-write) storage from other copies. */
+        [[nodiscard]] virtual values::Value load(ScopeStack& scope_stack) const {
+            return evaluate(scope_stack);
+        }
+
+        // emits instructions that leave the value of this expression on top of the operand stack
+        virtual void compile(bytecode::Compiler& compiler) const = 0;
+
+        // like `compile()`, but for reading only (see `load()`)
+        virtual void compile_load(bytecode::Compiler& compiler) const {
+            compile(compiler);
+        }
+
+        // annotates all variable references and definitions (see resolver.hpp)
+        virtual void resolve(Resolver& resolver) = 0;
+
+        // optimizes the subexpressions (see optimizer.hpp), returns a replacement for this expression or nullptr
+        [[nodiscard]] virtual std::unique_ptr<Expression> optimize(Optimizer& optimizer) = 0;
+
+        // writes this expression into a program image (see program_image.hpp)
+        virtual void serialize(ImageWriter& writer) const = 0;
+
+        // the value of this expression if it is known without evaluating it
+        [[nodiscard]] virtual std::optional<values::Value> constant_value() const {
+            return std::nullopt;
+        }
+
         [[nodiscard]] virtual SourceLocation source_location() const = 0;
     };
 } // namespace expressions
@@ -1,22 +1,67 @@
 #pragma once
 
+#include "../bytecode/compiler.hpp"
+#include "../optimizer.hpp"
+#include "../program_image.hpp"
+#include "../resolver.hpp"
 #include "expression.hpp"
 #include "../values/integer.hpp"
+#include <optional>
 
 namespace expressions {
     class IntegerLiteral final : public Expression {
     private:
         Token m_token;
+        std::optional<values::Integer::ValueType> m_value; // empty if the literal is out of range
 
     public:
-        explicit IntegerLiteral(Token token) : m_token{ token } { }
+        explicit IntegerLiteral(Token token) : m_token{ token } {
+            try {
+                m_value = m_token.parse_integer();
+            } catch (InvalidIntegerValue const&) {
+                // report the error only if this literal is actually evaluated at runtime
+            }
+        }
 
         [[nodiscard]] values::Value evaluate([[maybe_unused]] ScopeStack& scope_stack) const override {
-            return values::Integer::make(m_token.parse_integer(), values::ValueCategory::Rvalue);
+            if (not m_value.has_value()) {
+                return values::Integer::make(m_token.parse_integer(), values::ValueCategory::Rvalue); // throws
+            }
+            return values::Integer::make(m_value.value(), values::ValueCategory::Rvalue);
+        }
+
+        void compile(bytecode::Compiler& compiler) const override {
+            if (m_value.has_value()) {
+                compiler.emit_constant(values::Integer::make(m_value.value(), values::ValueCategory::Rvalue));
+            } else {
+                compiler.emit(bytecode::OpCode::ParseInteger, compiler.add_token(m_token));
+            }
+        }
+
+        void resolve([[maybe_unused]] Resolver& resolver) override { }
+
+        [[nodiscard]] std::unique_ptr<Expression> optimize([[maybe_unused]] Optimizer& optimizer) override {
+            return nullptr;
+        }
+
+        void serialize(ImageWriter& writer) const override {
+            writer.write_tag(NodeTag::IntegerLiteral);
+            writer.write_token(m_token);
+        }
+
+        [[nodiscard]] static std::unique_ptr<Expression> deserialize(ImageReader& reader) {
+            return reader.make<IntegerLiteral>(reader.read_token());
+        }
+
+        [[nodiscard]] std::optional<values::Value> constant_value() const override {
+            if (not m_value.has_value()) {
+                return std::nullopt;
+            }
+            return values::Integer::make(m_value.value(), values::ValueCategory::Rvalue);
         }
 
         [[nodiscard]] SourceLocation source_location() const override {
-            return m_token.source_location;
+            return m_token.source_location();
         }
     };
 }
\ No newline at end of file
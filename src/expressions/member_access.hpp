@@ -1,13 +1,33 @@
 #pragma once
 
+#include "../bytecode/compiler.hpp"
+#include "../optimizer.hpp"
+#include "../program_image.hpp"
+#include "../resolver.hpp"
+#include "../values/array.hpp"
+#include "../values/integer.hpp"
+#include "../values/struct.hpp"
 #include "expression.hpp"
 
 namespace expressions {
 
     class MemberAccess final : public Expression {
     private:
+        // see `BinaryOperator`
+        enum class Specialization : std::uint8_t {
+            Unknown,
+            ArraySize,
+            StringLength,
+            StructMember,
+            Generic,
+        };
+
         std::unique_ptr<Expression> m_lhs;
         Token m_member;
+        mutable Specialization m_specialization{ Specialization::Unknown };
+        // inline cache for struct members: the index of the member within the last seen struct definition
+        mutable statements::StructDefinition const* m_cached_definition{ nullptr };
+        mutable std::size_t m_cached_member_index{ 0 };
 
     public:
         MemberAccess(std::unique_ptr<Expression> object, Token const& member)
@@ -15,11 +35,47 @@ namespace expressions {
               m_member{ member } { }
 
         [[nodiscard]] values::Value evaluate(ScopeStack& scope_stack) const override {
-            return m_lhs->evaluate(scope_stack)->member_access(m_member);
+            return access<false>(m_lhs->evaluate(scope_stack));
+        }
+
+        // reading a member leaves a shared struct untouched (unlike `Struct::member()`)
+        [[nodiscard]] values::Value load(ScopeStack& scope_stack) const override {
+            return access<true>(m_lhs->load(scope_stack));
+        }
+
+        void compile(bytecode::Compiler& compiler) const override {
+            m_lhs->compile(compiler);
+            compiler.emit(bytecode::OpCode::MemberAccess, compiler.add_token(m_member));
+        }
+
+        void compile_load(bytecode::Compiler& compiler) const override {
+            m_lhs->compile_load(compiler);
+            compiler.emit(bytecode::OpCode::LoadMember, compiler.add_token(m_member));
+        }
+
+        void resolve(Resolver& resolver) override {
+            m_lhs->resolve(resolver);
+        }
+
+        [[nodiscard]] std::unique_ptr<Expression> optimize(Optimizer& optimizer) override {
+            optimizer.optimize(m_lhs);
+            return nullptr;
+        }
+
+        void serialize(ImageWriter& writer) const override {
+            writer.write_tag(NodeTag::MemberAccess);
+            writer.write_expression(*m_lhs);
+            writer.write_token(m_member);
+        }
+
+        [[nodiscard]] static std::unique_ptr<Expression> deserialize(ImageReader& reader) {
+            auto object = reader.read_expression();
+            auto const member = reader.read_token();
+            return reader.make<MemberAccess>(std::move(object), member);
         }
 
         [[nodiscard]] SourceLocation source_location() const override {
-            return SourceLocation::from_range(m_lhs->source_location(), m_member.source_location);
+            return SourceLocation::from_range(m_lhs->source_location(), m_member.source_location());
         }
 
         [[nodiscard]] std::unique_ptr<Expression> move_lhs_out() {
@@ -29,6 +85,81 @@ namespace expressions {
         [[nodiscard]] Token member_token() const {
             return m_member;
         }
+
+    private:
+        // `is_read_only` selects between an rvalue (see `load()`) and an lvalue of a struct member
+        template<bool is_read_only>
+        [[nodiscard]] values::Value access(values::Value const& object) const {
+            if (m_specialization == Specialization::Unknown) {
+                m_specialization = specialization_for(object);
+            }
+            switch (m_specialization) {
+                case Specialization::ArraySize:
+                    if (object->is_array()) {
+                        return values::Integer::make(
+                                static_cast<values::Integer::ValueType>(object->as_array().size()),
+                                values::ValueCategory::Rvalue
+                        );
+                    }
+                    m_specialization = Specialization::Generic;
+                    break;
+                case Specialization::StringLength:
+                    if (object->is_string_value()) {
+                        return values::Integer::make(
+                                static_cast<values::Integer::ValueType>(object->as_string().length()),
+                                values::ValueCategory::Rvalue
+                        );
+                    }
+                    m_specialization = Specialization::Generic;
+                    break;
+                case Specialization::StructMember:
+                    if (object->is_struct()) {
+                        auto const& struct_ = object->as_struct();
+                        if (struct_.definition() == m_cached_definition) {
+                            return member_of<is_read_only>(struct_, m_cached_member_index);
+                        }
+                        if (auto const index = struct_.definition()->member_index(m_member.symbol)) {
+                            m_cached_definition = struct_.definition();
+                            m_cached_member_index = index.value();
+                            return member_of<is_read_only>(struct_, m_cached_member_index);
+                        }
+                        break; // no such member
+                    }
+                    m_specialization = Specialization::Generic;
+                    break;
+                case Specialization::Unknown:
+                case Specialization::Generic:
+                    break;
+            }
+            if constexpr (is_read_only) {
+                if (object->is_struct()) {
+                    return object->as_struct().load_member(m_member);
+                }
+            }
+            return object->member_access(m_member);
+        }
+
+        template<bool is_read_only>
+        [[nodiscard]] static values::Value member_of(values::Struct const& struct_, std::size_t const index) {
+            if constexpr (is_read_only) {
+                return struct_.load_member(index);
+            } else {
+                return struct_.member(index);
+            }
+        }
+
+        [[nodiscard]] Specialization specialization_for(values::Value const& object) const {
+            if (object->is_array() and m_member.symbol == symbols::size) {
+                return Specialization::ArraySize;
+            }
+            if (object->is_string_value() and (m_member.symbol == symbols::size or m_member.symbol == symbols::length)) {
+                return Specialization::StringLength;
+            }
+            if (object->is_struct()) {
+                return Specialization::StructMember;
+            }
+            return Specialization::Generic;
+        }
     };
 
 } // namespace expressions
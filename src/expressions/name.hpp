@@ -1,25 +1,51 @@
 #pragma once
 
+#include "../bytecode/compiler.hpp"
+#include "../optimizer.hpp"
+#include "../program_image.hpp"
+#include "../resolver.hpp"
 #include "expression.hpp"
 
 namespace expressions {
     class Name final : public Expression {
     private:
         Token m_name;
+        Address m_address;
 
     public:
         explicit Name(Token name) : m_name{ name } { }
 
         [[nodiscard]] values::Value evaluate(ScopeStack& scope_stack) const override {
-            auto const variable = scope_stack.lookup(std::string{ m_name.lexeme() });
+            auto const variable = scope_stack.lookup(m_address, m_name.symbol);
             if (variable == nullptr) {
                 throw UndefinedReference{ m_name };
             }
             return *variable;
         }
 
+        void compile(bytecode::Compiler& compiler) const override {
+            compiler.emit(bytecode::OpCode::LoadName, compiler.add_token(m_name, m_address));
+        }
+
+        void resolve(Resolver& resolver) override {
+            m_address = resolver.lookup(m_name.symbol);
+        }
+
+        [[nodiscard]] std::unique_ptr<Expression> optimize([[maybe_unused]] Optimizer& optimizer) override {
+            return nullptr;
+        }
+
+        void serialize(ImageWriter& writer) const override {
+            writer.write_tag(NodeTag::Name);
+            writer.write_token(m_name);
+        }
+
+        [[nodiscard]] static std::unique_ptr<Expression> deserialize(ImageReader& reader) {
+            return reader.make<Name>(reader.read_token());
+        }
+
         [[nodiscard]] SourceLocation source_location() const override {
-            return m_name.source_location;
+            return m_name.source_location();
         }
     };
 }
\ No newline at end of file
@@ -1,5 +1,9 @@
 #pragma once
 
+#include "../bytecode/compiler.hpp"
+#include "../optimizer.hpp"
+#include "../program_image.hpp"
+#include "../resolver.hpp"
 #include "expression.hpp"
 
 namespace expressions {
@@ -16,7 +20,38 @@ namespace expressions {
               m_end{ std::move(end) } { }
 
         [[nodiscard]] values::Value evaluate(ScopeStack& scope_stack) const override {
-            return m_start->evaluate(scope_stack)->range(m_end->evaluate(scope_stack), m_end_is_inclusive);
+            return m_start->load(scope_stack)->range(m_end->load(scope_stack), m_end_is_inclusive);
+        }
+
+        void compile(bytecode::Compiler& compiler) const override {
+            m_start->compile_load(compiler);
+            m_end->compile_load(compiler);
+            compiler.emit(bytecode::OpCode::MakeRange, m_end_is_inclusive ? 1 : 0);
+        }
+
+        void resolve(Resolver& resolver) override {
+            m_start->resolve(resolver);
+            m_end->resolve(resolver);
+        }
+
+        [[nodiscard]] std::unique_ptr<Expression> optimize(Optimizer& optimizer) override {
+            optimizer.optimize(m_start);
+            optimizer.optimize(m_end);
+            return nullptr;
+        }
+
+        void serialize(ImageWriter& writer) const override {
+            writer.write_tag(NodeTag::Range);
+            writer.write_expression(*m_start);
+            writer.write_bool(m_end_is_inclusive);
+            writer.write_expression(*m_end);
+        }
+
+        [[nodiscard]] static std::unique_ptr<Expression> deserialize(ImageReader& reader) {
+            auto start = reader.read_expression();
+            auto const end_is_inclusive = reader.read_bool();
+            auto end = reader.read_expression();
+            return reader.make<Range>(std::move(start), end_is_inclusive, std::move(end));
         }
 
         [[nodiscard]] SourceLocation source_location() const override {
@@ -1,5 +1,9 @@
 #pragma once
 
+#include "../bytecode/compiler.hpp"
+#include "../optimizer.hpp"
+#include "../program_image.hpp"
+#include "../resolver.hpp"
 #include "expression.hpp"
 #include "../values/string.hpp"
 
@@ -7,19 +11,45 @@ namespace expressions {
     class StringLiteral final : public Expression {
     private:
         Token m_token;
+        values::Value m_value; // created once, every evaluation hands out a copy sharing its characters
 
     public:
-        explicit StringLiteral(Token token) : m_token{ token } { }
+        explicit StringLiteral(Token token)
+            : m_token{ token },
+              m_value{ values::String::make(
+                      std::string{ m_token.lexeme().substr(1, m_token.lexeme().length() - 2) },
+                      values::ValueCategory::Rvalue
+              ) } { }
 
         [[nodiscard]] values::Value evaluate([[maybe_unused]] ScopeStack& scope_stack) const override {
-            return values::String::make(
-                    std::string{ m_token.lexeme().substr(1, m_token.lexeme().length() - 2) },
-                    values::ValueCategory::Rvalue
-            );
+            return m_value->clone();
+        }
+
+        void compile(bytecode::Compiler& compiler) const override {
+            compiler.emit_constant(m_value);
+        }
+
+        void resolve([[maybe_unused]] Resolver& resolver) override { }
+
+        [[nodiscard]] std::unique_ptr<Expression> optimize([[maybe_unused]] Optimizer& optimizer) override {
+            return nullptr;
+        }
+
+        void serialize(ImageWriter& writer) const override {
+            writer.write_tag(NodeTag::StringLiteral);
+            writer.write_token(m_token);
+        }
+
+        [[nodiscard]] static std::unique_ptr<Expression> deserialize(ImageReader& reader) {
+            return reader.make<StringLiteral>(reader.read_token());
+        }
+
+        [[nodiscard]] std::optional<values::Value> constant_value() const override {
+            return m_value->clone();
         }
 
         [[nodiscard]] SourceLocation source_location() const override {
-            return m_token.source_location;
+            return m_token.source_location();
         }
     };
 }
\ No newline at end of file
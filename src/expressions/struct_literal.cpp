@@ -3,7 +3,20 @@
 #include "../values/value.hpp"
 
 values::Value expressions::StructLiteral::evaluate(ScopeStack& scope_stack) const {
-    auto const type = scope_stack.lookup(std::string{ m_name.lexeme() });
+    auto initializer_values = std::vector<values::Value>{};
+    initializer_values.reserve(m_initializers.size());
+    for (auto const& initializer : m_initializers) {
+        initializer_values.push_back(initializer.value->load(scope_stack));
+    }
+    return instantiate(scope_stack, std::move(initializer_values));
+}
+
+values::Value expressions::StructLiteral::instantiate(
+        ScopeStack& scope_stack,
+        std::vector<values::Value> initializer_values
+) const {
+    assert(initializer_values.size() == m_initializers.size());
+    auto const type = scope_stack.lookup(m_type_address, m_name.symbol);
     if (type == nullptr) {
         throw UndefinedReference{ m_name };
     }
@@ -11,41 +24,61 @@ values::Value expressions::StructLiteral::evaluate(ScopeStack& scope_stack) cons
         throw UnknownType{ m_name };
     }
 
-    auto const& definition = (*type)->as_struct_type();
-
-    auto value_members = std::unordered_map<std::string, values::Value>{};
-
-    for (auto const& [name, value] : m_initializers) {
-        auto evaluated = value->evaluate(scope_stack);
-        evaluated->promote_to_lvalue();
-        auto const& [iterator, inserted] = value_members.insert({ std::string{ name.lexeme() }, std::move(evaluated) });
-        if (not inserted) {
-            // todo: throw different exception type
-            throw std::runtime_error{ "duplicate struct initializer" };
-        }
+    auto const definition = (*type)->as_struct_type().value();
+    auto const& layout = this->layout(definition);
+    if (layout.has_duplicate_initializers) {
+        // todo: throw different exception type
+        throw std::runtime_error{ "duplicate struct initializer" };
     }
 
-    for (auto const& [name, type] : definition.value()->members()) {
-        auto const find_iterator = value_members.find(std::string{ name.lexeme() });
-        auto const found = (find_iterator != value_members.end());
-        if (not found) {
+    auto members = values::Struct::Members{};
+    members.reserve(definition->members().size());
+    for (std::size_t i = 0; i < definition->members().size(); ++i) {
+        auto const& initializer_index = layout.initializer_indices.at(i);
+        if (not initializer_index.has_value()) {
             // todo: throw different exception type
             throw std::runtime_error{ "missing initializer for struct member" };
         }
-        if (not type->can_be_created_from(find_iterator->second->type())) {
+        auto& evaluated = initializer_values.at(initializer_index.value());
+        if (not definition->members().at(i).m_type->can_be_created_from(evaluated->type())) {
             // todo: throw different exception type
             throw std::runtime_error{ "struct member initializer has wrong type" };
         }
+        evaluated->promote_to_lvalue();
+        members.push_back(std::move(evaluated));
     }
 
-    if (value_members.size() > definition.value()->members().size()) {
+    if (layout.has_unknown_initializers) {
         // todo: throw different exception type
         throw std::runtime_error{ "too many struct member initializers" };
     }
 
-    return values::Struct::make(
-            definition.as_struct_type().value(),
-            std::move(value_members),
-            values::ValueCategory::Rvalue
-    );
+    return values::Struct::make(definition, std::move(members), values::ValueCategory::Rvalue);
+}
+
+expressions::StructLiteral::Layout const& expressions::StructLiteral::layout(
+        statements::StructDefinition const* const definition
+) const {
+    if (m_layout.definition == definition) {
+        return m_layout;
+    }
+    m_layout = Layout{ definition, {}, false, false };
+    m_layout.initializer_indices.resize(definition->members().size());
+    for (std::size_t i = 0; i < m_initializers.size(); ++i) {
+        auto const name = m_initializers.at(i).name.symbol;
+        for (std::size_t j = 0; j < i; ++j) {
+            if (m_initializers.at(j).name.symbol == name) {
+                m_layout.has_duplicate_initializers = true;
+            }
+        }
+        auto const member_index = definition->member_index(name);
+        if (not member_index.has_value()) {
+            m_layout.has_unknown_initializers = true;
+            continue;
+        }
+        if (not m_layout.initializer_indices.at(member_index.value()).has_value()) {
+            m_layout.initializer_indices.at(member_index.value()) = i;
+        }
+    }
+    return m_layout;
 }
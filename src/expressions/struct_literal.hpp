@@ -2,6 +2,10 @@
 
 #include "../values/nothing.hpp"
 #include "../values/struct.hpp"
+#include "../bytecode/compiler.hpp"
+#include "../optimizer.hpp"
+#include "../program_image.hpp"
+#include "../resolver.hpp"
 #include "expression.hpp"
 
 namespace expressions {
@@ -15,6 +19,18 @@ namespace expressions {
         Token m_name;
         std::vector<StructMemberInitializer> m_initializers;
         Token m_closing_curly_bracket_token;
+        Address m_type_address;
+
+        /* Maps the initializers onto the members of the struct definition. It is determined when the
+         * literal is instantiated for the first time and reused as long as the same definition is used. */
+        struct Layout final {
+            statements::StructDefinition const* definition{ nullptr };
+            std::vector<std::optional<std::size_t>> initializer_indices; // in the order of the struct members
+            bool has_duplicate_initializers{ false };
+            bool has_unknown_initializers{ false };
+        };
+
+        mutable Layout m_layout;
 
     public:
         StructLiteral(
@@ -28,8 +44,63 @@ namespace expressions {
 
         [[nodiscard]] values::Value evaluate(ScopeStack& scope_stack) const override;
 
+        void compile(bytecode::Compiler& compiler) const override {
+            for (auto const& initializer : m_initializers) {
+                initializer.value->compile_load(compiler);
+            }
+            compiler.emit(bytecode::OpCode::MakeStruct, compiler.add_expression(*this));
+        }
+
+        void resolve(Resolver& resolver) override {
+            for (auto const& initializer : m_initializers) {
+                initializer.value->resolve(resolver);
+            }
+            m_type_address = resolver.lookup(m_name.symbol);
+        }
+
+        [[nodiscard]] std::unique_ptr<Expression> optimize(Optimizer& optimizer) override {
+            for (auto& initializer : m_initializers) {
+                optimizer.optimize(initializer.value);
+            }
+            return nullptr;
+        }
+
+        void serialize(ImageWriter& writer) const override {
+            writer.write_tag(NodeTag::StructLiteral);
+            writer.write_token(m_name);
+            writer.write_u64(m_initializers.size());
+            for (auto const& initializer : m_initializers) {
+                writer.write_token(initializer.name);
+                writer.write_expression(*initializer.value);
+            }
+            writer.write_token(m_closing_curly_bracket_token);
+        }
+
+        [[nodiscard]] static std::unique_ptr<Expression> deserialize(ImageReader& reader) {
+            auto const name = reader.read_token();
+            auto const num_initializers = reader.read_u64();
+            auto initializers = std::vector<StructMemberInitializer>{};
+            for (auto i = std::uint64_t{ 0 }; i < num_initializers; ++i) {
+                auto const member_name = reader.read_token();
+                initializers.push_back(StructMemberInitializer{ member_name, reader.read_expression() });
+            }
+            auto const closing_curly_bracket_token = reader.read_token();
+            return reader.make<StructLiteral>(name, std::move(initializers), closing_curly_bracket_token);
+        }
+
+        [[nodiscard]] std::size_t num_initializers() const {
+            return m_initializers.size();
+        }
+
+        // creates the struct value from the already evaluated initializer values (in order of appearance)
+        [[nodiscard]] values::Value instantiate(ScopeStack& scope_stack, std::vector<values::Value> initializer_values)
+                const;
+
         [[nodiscard]] SourceLocation source_location() const override {
-            return SourceLocation::from_range(m_name.source_location, m_closing_curly_bracket_token.source_location);
+            return SourceLocation::from_range(m_name.source_location(), m_closing_curly_bracket_token.source_location());
         }
+
+    private:
+        [[nodiscard]] Layout const& layout(statements::StructDefinition const* definition) const;
     };
 } // namespace expressions
@@ -1,13 +1,26 @@
 #pragma once
 
+#include "../bytecode/compiler.hpp"
+#include "../optimizer.hpp"
+#include "../program_image.hpp"
+#include "../resolver.hpp"
+#include "../values/array.hpp"
 #include "expression.hpp"
 
 namespace expressions {
     class Subscript final : public Expression {
     private:
+        // see `BinaryOperator`
+        enum class Specialization : std::uint8_t {
+            Unknown,
+            ArrayElement,
+            Generic,
+        };
+
         std::unique_ptr<Expression> m_expression;
         std::unique_ptr<Expression> m_subscript;
         Token m_closing_bracket;
+        mutable Specialization m_specialization{ Specialization::Unknown };
 
     public:
         Subscript(
@@ -20,11 +33,75 @@ namespace expressions {
               m_closing_bracket{ closing_bracket } { }
 
         [[nodiscard]] values::Value evaluate(ScopeStack& scope_stack) const override {
-            return m_expression->evaluate(scope_stack)->subscript(m_subscript->evaluate(scope_stack));
+            auto const container = m_expression->evaluate(scope_stack);
+            auto const index = m_subscript->load(scope_stack);
+            if (m_specialization == Specialization::Unknown) {
+                m_specialization = (container->is_array() and index->is_integer_value()) ? Specialization::ArrayElement
+                                                                                          : Specialization::Generic;
+            }
+            if (m_specialization == Specialization::ArrayElement) {
+                if (container->is_array() and index->is_integer_value()) {
+                    auto const& array = container->as_array();
+                    auto const index_value = index->as_integer_value();
+                    if (index_value < 0 or static_cast<std::size_t>(index_value) >= array.size()) {
+                        throw IndexOutOfBounds{ index_value, static_cast<std::int32_t>(array.size()) };
+                    }
+                    return array.at(static_cast<std::size_t>(index_value));
+                }
+                m_specialization = Specialization::Generic;
+            }
+            return container->subscript(index);
+        }
+
+        // reading an element leaves a shared array untouched (unlike `Array::at()`)
+        [[nodiscard]] values::Value load(ScopeStack& scope_stack) const override {
+            auto const container = m_expression->load(scope_stack);
+            auto const index = m_subscript->load(scope_stack);
+            if (container->is_array()) {
+                return container->as_array().load_subscript(index);
+            }
+            return container->subscript(index);
+        }
+
+        void compile(bytecode::Compiler& compiler) const override {
+            m_expression->compile(compiler);
+            m_subscript->compile_load(compiler);
+            compiler.emit(bytecode::OpCode::Subscript);
+        }
+
+        void compile_load(bytecode::Compiler& compiler) const override {
+            m_expression->compile_load(compiler);
+            m_subscript->compile_load(compiler);
+            compiler.emit(bytecode::OpCode::LoadSubscript);
+        }
+
+        void resolve(Resolver& resolver) override {
+            m_expression->resolve(resolver);
+            m_subscript->resolve(resolver);
+        }
+
+        [[nodiscard]] std::unique_ptr<Expression> optimize(Optimizer& optimizer) override {
+            optimizer.optimize(m_expression);
+            optimizer.optimize(m_subscript);
+            return nullptr;
+        }
+
+        void serialize(ImageWriter& writer) const override {
+            writer.write_tag(NodeTag::Subscript);
+            writer.write_expression(*m_expression);
+            writer.write_expression(*m_subscript);
+            writer.write_token(m_closing_bracket);
+        }
+
+        [[nodiscard]] static std::unique_ptr<Expression> deserialize(ImageReader& reader) {
+            auto expression = reader.read_expression();
+            auto subscript = reader.read_expression();
+            auto const closing_bracket = reader.read_token();
+            return reader.make<Subscript>(std::move(expression), std::move(subscript), closing_bracket);
         }
 
         [[nodiscard]] SourceLocation source_location() const override {
-            return SourceLocation::from_range(m_expression->source_location(), m_closing_bracket.source_location);
+            return SourceLocation::from_range(m_expression->source_location(), m_closing_bracket.source_location());
         }
     };
 }
\ No newline at end of file
@@ -1,6 +1,10 @@
 #pragma once
 
 #include "../values/string.hpp"
+#include "../bytecode/compiler.hpp"
+#include "../optimizer.hpp"
+#include "../program_image.hpp"
+#include "../resolver.hpp"
 #include "expression.hpp"
 
 namespace expressions {
@@ -22,15 +26,43 @@ namespace expressions {
 
         [[nodiscard]] values::Value evaluate(ScopeStack& scope_stack) const override {
             return values::String::make(
-                    m_expression->evaluate(scope_stack)->type()->to_string(),
+                    m_expression->load(scope_stack)->type()->to_string(),
                     values::ValueCategory::Rvalue
             );
         }
 
+        void compile(bytecode::Compiler& compiler) const override {
+            m_expression->compile_load(compiler);
+            compiler.emit(bytecode::OpCode::TypeOf);
+        }
+
+        void resolve(Resolver& resolver) override {
+            m_expression->resolve(resolver);
+        }
+
+        [[nodiscard]] std::unique_ptr<Expression> optimize(Optimizer& optimizer) override {
+            optimizer.optimize(m_expression);
+            return nullptr;
+        }
+
+        void serialize(ImageWriter& writer) const override {
+            writer.write_tag(NodeTag::TypeOf);
+            writer.write_token(m_typeof_token);
+            writer.write_expression(*m_expression);
+            writer.write_token(m_closing_parenthesis_token);
+        }
+
+        [[nodiscard]] static std::unique_ptr<Expression> deserialize(ImageReader& reader) {
+            auto const typeof_token = reader.read_token();
+            auto expression = reader.read_expression();
+            auto const closing_parenthesis_token = reader.read_token();
+            return reader.make<TypeOf>(typeof_token, std::move(expression), closing_parenthesis_token);
+        }
+
         [[nodiscard]] SourceLocation source_location() const override {
             return SourceLocation::from_range(
-                    m_typeof_token.source_location,
-                    m_closing_parenthesis_token.source_location
+                    m_typeof_token.source_location(),
+                    m_closing_parenthesis_token.source_location()
             );
         }
     };
@@ -1,12 +1,27 @@
 #pragma once
 
+#include "../bytecode/compiler.hpp"
+#include "../optimizer.hpp"
+#include "../program_image.hpp"
+#include "../resolver.hpp"
+#include "../values/integer.hpp"
 #include "expression.hpp"
+#include <cstdint>
+#include <limits>
 
 namespace expressions {
     class UnaryOperator final : public Expression {
     private:
+        // see `BinaryOperator`
+        enum class Specialization : std::uint8_t {
+            Unknown,
+            Integer,
+            Generic,
+        };
+
         Token m_operator_token;
         std::unique_ptr<Expression> m_operand;
+        mutable Specialization m_specialization{ Specialization::Unknown };
 
     public:
         UnaryOperator(Token operator_token, std::unique_ptr<Expression> operand)
@@ -14,19 +29,81 @@ namespace expressions {
               m_operand{ std::move(operand) } { }
 
         [[nodiscard]] values::Value evaluate(ScopeStack& scope_stack) const override {
+            auto const operand = m_operand->load(scope_stack);
+            if (m_specialization == Specialization::Unknown) {
+                m_specialization = operand->is_integer_value() ? Specialization::Integer : Specialization::Generic;
+            }
+            if (m_specialization == Specialization::Integer) {
+                if (operand->is_integer_value()) {
+                    auto const value = operand->as_integer_value();
+                    auto const result = (m_operator_token.type == TokenType::Minus ? -value : value);
+                    return values::Integer::make(result, values::ValueCategory::Rvalue);
+                }
+                m_specialization = Specialization::Generic;
+            }
+            return apply(operand);
+        }
+
+        void compile(bytecode::Compiler& compiler) const override {
+            m_operand->compile_load(compiler);
             switch (m_operator_token.type) {
                 case TokenType::Plus:
-                    return m_operand->evaluate(scope_stack)->unary_plus();
+                    compiler.emit(bytecode::OpCode::UnaryPlus);
+                    break;
                 case TokenType::Minus:
-                    return m_operand->evaluate(scope_stack)->unary_minus();
+                    compiler.emit(bytecode::OpCode::UnaryMinus);
+                    break;
                 default:
                     assert(false and "unreachable");
-                    return {};
+                    break;
             }
         }
 
+        void resolve(Resolver& resolver) override {
+            m_operand->resolve(resolver);
+        }
+
+        [[nodiscard]] std::unique_ptr<Expression> optimize(Optimizer& optimizer) override {
+            optimizer.optimize(m_operand);
+            auto const operand = m_operand->constant_value();
+            if (not operand.has_value()) {
+                return nullptr;
+            }
+            // negating `INT_MIN` overflows, so it is left for the runtime (see `BinaryOperator::can_be_folded()`)
+            if (m_operator_token.type == TokenType::Minus and operand.value()->is_integer_value()
+                and operand.value()->as_integer_value() == std::numeric_limits<std::int32_t>::min()) {
+                return nullptr;
+            }
+            return optimizer.fold(source_location(), [&] { return apply(operand.value()); });
+        }
+
+        void serialize(ImageWriter& writer) const override {
+            writer.write_tag(NodeTag::UnaryOperator);
+            writer.write_token(m_operator_token);
+            writer.write_expression(*m_operand);
+        }
+
+        [[nodiscard]] static std::unique_ptr<Expression> deserialize(ImageReader& reader) {
+            auto const operator_token = reader.read_token();
+            auto operand = reader.read_expression();
+            return reader.make<UnaryOperator>(operator_token, std::move(operand));
+        }
+
         [[nodiscard]] SourceLocation source_location() const override {
-            return SourceLocation::from_range(m_operator_token.source_location, m_operand->source_location());
+            return SourceLocation::from_range(m_operator_token.source_location(), m_operand->source_location());
+        }
+
+    private:
+        [[nodiscard]] values::Value apply(values::Value const& operand) const {
+            switch (m_operator_token.type) {
+                case TokenType::Plus:
+                    return operand->unary_plus();
+                case TokenType::Minus:
+                    return operand->unary_minus();
+                default:
+                    assert(false and "unreachable");
+                    return {};
+            }
         }
     };
 }
\ No newline at end of file
@@ -1,27 +1,30 @@
 #include "interpreter.hpp"
+#include "bytecode/virtual_machine.hpp"
 #include "values/builtin_function.hpp"
 
-void interpret(statements::Statements const& program) {
+[[nodiscard]] static ScopeStack create_global_scope_stack() {
     auto scope_stack = ScopeStack{};
-    scope_stack.top().insert(
-            { "split", values::BuiltinFunction::make(BuiltinFunctionType::Split, values::ValueCategory::Rvalue) }
-    );
-    scope_stack.top().insert(
-            { "join", values::BuiltinFunction::make(BuiltinFunctionType::Join, values::ValueCategory::Rvalue) }
-    );
-    scope_stack.top().insert(
-            { "delete", values::BuiltinFunction::make(BuiltinFunctionType::Delete, values::ValueCategory::Rvalue) }
-    );
-    scope_stack.top().insert(
-            { "write", values::BuiltinFunction::make(BuiltinFunctionType::Write, values::ValueCategory::Rvalue) }
-    );
-    scope_stack.top().insert(
-            { "read", values::BuiltinFunction::make(BuiltinFunctionType::Read, values::ValueCategory::Rvalue) }
-    );
-    scope_stack.top().insert(
-            { "trim", values::BuiltinFunction::make(BuiltinFunctionType::Trim, values::ValueCategory::Rvalue) }
-    );
+    for (auto const type : builtin_function_types) {
+        scope_stack.append(
+                symbols::builtin_function(type),
+                values::BuiltinFunction::make(type, values::ValueCategory::Rvalue)
+        );
+    }
+    return scope_stack;
+}
+
+void interpret(statements::Statements const& program) {
+    auto scope_stack = create_global_scope_stack();
     for (auto const& statement : program) {
-        statement->execute(scope_stack);
+        auto const completion = statement->execute(scope_stack);
+        if (not completion.is_normal()) {
+            completion.throw_unhandled();
+        }
     }
 }
+
+void interpret(bytecode::Program const& program) {
+    auto scope_stack = create_global_scope_stack();
+    auto virtual_machine = bytecode::VirtualMachine{ program, scope_stack };
+    virtual_machine.run();
+}
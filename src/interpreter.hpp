@@ -1,5 +1,8 @@
 #pragma once
 
+#include "bytecode/program.hpp"
 #include "statements/statement.hpp"
 
 void interpret(statements::Statements const& program);
+
+void interpret(bytecode::Program const& program);
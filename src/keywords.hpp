@@ -0,0 +1,96 @@
+#pragma once
+
+#include "token.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+
+/* Keywords are recognized by the lexer with a perfect hash: the hash function only looks at the
+ * first and last character and at the length of a word, and its factors are chosen at compile time
+ * so that no two keywords end up in the same slot of the table. Thus, classifying an identifier
+ * needs a single string comparison at most. Words that are only special in certain places (like
+ * `print` or `in`) are no keywords but contextual names that the parser recognizes by their symbol. */
+namespace keywords {
+    struct Keyword final {
+        std::string_view lexeme;
+        TokenType type;
+    };
+
+    inline constexpr auto all = std::to_array<Keyword>({
+            {      "and",      TokenType::And },
+            {    "false",    TokenType::False },
+            {      "for",      TokenType::For },
+            { "function", TokenType::Function },
+            {       "if",       TokenType::If },
+            {      "let",      TokenType::Let },
+            {      "mod",      TokenType::Mod },
+            {      "new",      TokenType::New },
+            {       "or",       TokenType::Or },
+            {   "struct",   TokenType::Struct },
+            {     "true",     TokenType::True },
+            {   "typeof",   TokenType::TypeOf },
+            {    "while",    TokenType::While },
+    });
+
+    namespace detail {
+        inline constexpr auto table_size = std::size_t{ 64 };
+
+        struct HashFactors final {
+            std::uint32_t first;
+            std::uint32_t last;
+        };
+
+        [[nodiscard]] constexpr std::size_t hash(std::string_view const word, HashFactors const factors) {
+            auto const first = static_cast<unsigned char>(word.front());
+            auto const last = static_cast<unsigned char>(word.back());
+            return (first * factors.first + last * factors.last + word.length()) % table_size;
+        }
+
+        [[nodiscard]] consteval HashFactors find_hash_factors() {
+            for (auto first = std::uint32_t{ 1 }; first < table_size; ++first) {
+                for (auto last = std::uint32_t{ 1 }; last < table_size; ++last) {
+                    auto const factors = HashFactors{ first, last };
+                    auto is_occupied = std::array<bool, table_size>{};
+                    auto has_collision = false;
+                    for (auto const& keyword : all) {
+                        auto const slot = hash(keyword.lexeme, factors);
+                        has_collision = has_collision or is_occupied[slot];
+                        is_occupied[slot] = true;
+                    }
+                    if (not has_collision) {
+                        return factors;
+                    }
+                }
+            }
+            throw std::logic_error{ "no perfect hash found, the table has to be enlarged" };
+        }
+
+        inline constexpr auto hash_factors = find_hash_factors();
+
+        // empty slots contain an empty lexeme
+        [[nodiscard]] consteval std::array<Keyword, table_size> make_table() {
+            auto result = std::array<Keyword, table_size>{};
+            for (auto const& keyword : all) {
+                result[hash(keyword.lexeme, hash_factors)] = keyword;
+            }
+            return result;
+        }
+
+        inline constexpr auto table = make_table();
+    } // namespace detail
+
+    // returns the keyword token type for the given word or `TokenType::Identifier` if it is no keyword
+    [[nodiscard]] constexpr TokenType classify(std::string_view const word) {
+        if (word.empty()) {
+            return TokenType::Identifier;
+        }
+        auto const& entry = detail::table[detail::hash(word, detail::hash_factors)];
+        return entry.lexeme == word ? entry.type : TokenType::Identifier;
+    }
+
+    static_assert(classify("function") == TokenType::Function);
+    static_assert(classify("functio") == TokenType::Identifier);
+    static_assert(classify("println") == TokenType::Identifier); // contextual (see symbols.hpp)
+} // namespace keywords
@@ -1,7 +1,10 @@
 #include "lexer.hpp"
 #include "lexer_error.hpp"
+#include "keywords.hpp"
 #include "overloaded.hpp"
+#include "scanner.hpp"
 #include "source_location.hpp"
+#include "source_table.hpp"
 #include <format>
 
 namespace {
@@ -22,21 +25,26 @@ namespace {
 
 class LexerState final {
 private:
-    std::string_view m_filename;
     std::string_view m_source;
+    std::uint32_t m_first_offset; // the global offset of the source (see source_table.hpp)
     std::size_t m_current_index{ 0 };
 
+    [[nodiscard]] std::uint32_t global_offset(std::size_t const byte_offset) const {
+        // the source table ensures that all offsets of the source (and the one after it) fit
+        return m_first_offset + static_cast<std::uint32_t>(byte_offset);
+    }
+
 public:
-    explicit LexerState(std::string_view const filename, std::string_view const source)
-        : m_filename{ filename },
-          m_source{ source } { }
+    LexerState(std::string_view const filename, std::string_view const source)
+        : m_source{ source },
+          m_first_offset{ SourceTable::instance().add(filename, source) } { }
 
     [[nodiscard]] bool is_at_end() const {
         return m_current_index >= m_source.length();
     }
 
     [[nodiscard]] char current() const {
-        return is_at_end() ? '\0' : m_source.at(m_current_index);
+        return is_at_end() ? '\0' : m_source[m_current_index];
     }
 
     [[nodiscard]] std::string_view substring(std::size_t const position, std::size_t const length) const {
@@ -44,7 +52,19 @@ public:
     }
 
     [[nodiscard]] SourceLocation source_location(std::size_t const byte_offset, std::size_t const num_bytes) const {
-        return SourceLocation{ m_filename, m_source, byte_offset, num_bytes };
+        return SourceTable::instance().location(global_offset(byte_offset), static_cast<std::uint32_t>(num_bytes));
+    }
+
+    [[nodiscard]] Token make_token(
+            TokenType const type,
+            std::size_t const byte_offset,
+            std::size_t const num_bytes,
+            SymbolId const symbol = symbols::none
+    ) const {
+        if (num_bytes > Token::max_length) {
+            throw LexerError{ TokenTooLong{ source_location(byte_offset, num_bytes) } };
+        }
+        return Token{ type, global_offset(byte_offset), static_cast<std::uint32_t>(num_bytes), symbol };
     }
 
     [[nodiscard]] SourceLocation current_source_location(std::size_t const num_bytes = 1) const {
@@ -55,29 +75,31 @@ public:
         ++m_current_index;
     }
 
-    friend class Tokens;
-};
+    // moves to the given position, which must not be before the current one
+    void advance_to(std::size_t const position) {
+        assert(position >= m_current_index and position <= m_source.length());
+        m_current_index = position;
+    }
 
-[[nodiscard]] static bool is_valid_identifier_start(char const c) {
-    return (c >= 'a' and c <= 'z') or (c >= 'A' and c <= 'Z') or c == '_';
-}
+    [[nodiscard]] std::string_view source() const {
+        return m_source;
+    }
 
-[[nodiscard]] static bool is_valid_identifier_continuation(char const c) {
-    return is_valid_identifier_start(c) or (c >= '0' and c <= '9');
-}
+    friend class Tokens;
+};
 
 [[nodiscard]] Tokens Tokens::tokenize(std::string_view const filename, std::string_view const source) {
-    auto state = LexerState{ filename, source };
     auto tokens = Tokens{};
+    // typical sources have about one token per 4 to 8 bytes, this avoids most reallocations
+    tokens.m_tokens.reserve(source.length() / 6 + 1);
+    auto state = LexerState{ filename, source };
 
     auto const add_token = overloaded{
         [&](TokenType const type, std::size_t const position, std::size_t const length = 1) {
-            auto const source_location = SourceLocation{ filename, source, position, length };
-            tokens.m_tokens.emplace_back(type, source_location);
+            tokens.m_tokens.push_back(state.make_token(type, position, length));
         },
         [&](TokenType const type) {
-            auto const source_location = SourceLocation{ filename, source, state.m_current_index, 1 };
-            tokens.m_tokens.emplace_back(type, source_location);
+            tokens.m_tokens.push_back(state.make_token(type, state.m_current_index, 1));
         },
     };
 
@@ -232,9 +254,7 @@ public:
                 state.advance(); // consume "/"
                 if (state.current() == '/') {
                     // one line comment
-                    while (not state.is_at_end() and state.current() != '\n') {
-                        state.advance();
-                    }
+                    state.advance_to(scanner::find(state.source(), state.m_current_index, '\n'));
                     break;
                 }
                 if (state.current() == '=') {
@@ -273,12 +293,9 @@ public:
             }
             case '"': {
                 auto const start = state.m_current_index;
-                auto length = 1;
                 state.advance();
-                while (not state.is_at_end() and state.current() != '"') {
-                    state.advance();
-                    ++length;
-                }
+                state.advance_to(scanner::find(state.source(), state.m_current_index, '"'));
+                auto length = state.m_current_index - start;
                 if (state.is_at_end()) {
                     throw LexerError{
                         UnclosedStringLiteral{ state.source_location(start, length),
@@ -291,33 +308,29 @@ public:
                 break;
             }
             default:
-                if (std::isspace(static_cast<unsigned char>(current))) {
-                    state.advance();
+                if (scanner::is_whitespace(current)) {
+                    state.advance_to(scanner::skip_whitespace(state.source(), state.m_current_index));
                     continue;
                 }
 
-                if (std::isdigit(static_cast<unsigned char>(current))) {
+                if (scanner::is_digit(current)) {
                     auto const start = state.m_current_index;
-                    auto length = std::size_t{ 1 };
-                    state.advance();
-
-                    while (not state.is_at_end() and std::isdigit(static_cast<unsigned char>(state.current()))) {
-                        ++length;
-                        state.advance();
-                    }
-                    add_token(TokenType::IntegerLiteral, start, length);
+                    state.advance_to(scanner::skip_digits(state.source(), start + 1));
+                    add_token(TokenType::IntegerLiteral, start, state.m_current_index - start);
                     continue;
                 }
 
-                if (is_valid_identifier_start(current)) {
+                if (scanner::is_identifier_start(current)) {
                     auto const start = state.m_current_index;
-                    auto length = std::size_t{ 1 };
-                    state.advance();
-                    while (not state.is_at_end() and is_valid_identifier_continuation(state.current())) {
-                        ++length;
-                        state.advance();
+                    state.advance_to(scanner::skip_identifier_continuation(state.source(), start + 1));
+                    auto const length = state.m_current_index - start;
+                    auto const lexeme = state.substring(start, length);
+                    auto const type = keywords::classify(lexeme);
+                    if (type == TokenType::Identifier) {
+                        tokens.m_tokens.push_back(state.make_token(type, start, length, tokens.m_symbols.intern(lexeme)));
+                    } else {
+                        add_token(type, start, length);
                     }
-                    add_token(TokenType::Identifier, start, length);
                     continue;
                 }
 
@@ -327,6 +340,6 @@ public:
         }
     }
 
-    tokens.m_tokens.emplace_back(TokenType::EndOfInput, SourceLocation{ filename, source, source.length() - 1, 1 });
+    tokens.m_tokens.push_back(state.make_token(TokenType::EndOfInput, source.empty() ? 0 : source.length() - 1, 1));
     return tokens;
 }
@@ -3,11 +3,14 @@
 #include <string_view>
 #include <vector>
 #include <iostream>
+#include <memory>
+#include "source_location.hpp"
 #include "token.hpp"
 
 class Tokens {
 private:
     std::vector<Token> m_tokens;
+    SymbolTable m_symbols;
 
 public:
     operator const std::vector<Token>&() const { // NOLINT
@@ -16,6 +19,11 @@ public:
 
     [[nodiscard]] static Tokens tokenize(std::string_view filename, std::string_view source);
 
+    // the names of all identifiers
+    [[nodiscard]] SymbolTable const& symbols() const {
+        return m_symbols;
+    }
+
     [[nodiscard]] std::size_t size() const {
         return m_tokens.size();
     }
@@ -67,13 +67,20 @@ private:
     }
 };
 
+class TokenTooLong final : public LexerErrorBase {
+public:
+    explicit TokenTooLong(SourceLocation const& source_location)
+        : LexerErrorBase{ source_location, "token exceeds the maximum length" } { }
+};
+
 using LexerErrorKind = std::variant<
         UnexpectedChar,
         UnclosedStringLiteral,
         ForbiddenCharacterInStringLiteral,
         UnclosedCharLiteral,
         InvalidEscapeSequence,
-        InvalidCharLiteral>;
+        InvalidCharLiteral,
+        TokenTooLong>;
 
 class LexerError final : public std::exception {
 private:
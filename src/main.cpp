@@ -1,44 +1,101 @@
+#include "arena.hpp"
+#include "bytecode/compiler.hpp"
 #include "control_flow.hpp"
 #include "interpreter.hpp"
 #include "lexer.hpp"
 #include "lexer_error.hpp"
+#include "optimizer.hpp"
 #include "parser.hpp"
 #include "parser_error.hpp"
+#include "program_cache.hpp"
+#include "resolver.hpp"
 #include "runtime_error.hpp"
+#include "source_file.hpp"
+#include "values/pool.hpp"
 #include <exception>
 #include <filesystem>
 #include <format>
-#include <fstream>
 #include <iostream>
-#include <sstream>
-#include <string>
-
-[[nodiscard]] std::string read_file(std::filesystem::path const& path) {
-    auto const file = std::ifstream{ path };
-    if (not file) {
-        throw std::runtime_error{ std::format("unable to open file '{}'", path.string()) };
-    }
-    auto stream = std::stringstream{};
-    stream << file.rdbuf();
-    return std::move(stream).str();
-}
+#include <optional>
+#include <string_view>
 
 int main(int const argc, char const* const* const argv) try {
 #ifdef EMSCRIPTEN
     static constexpr auto filename = std::string_view{ "programs/test.las" };
+    static constexpr auto use_virtual_machine = false;
+    static constexpr auto print_statistics = false;
+    static constexpr auto optimize = false;
+    static constexpr auto use_cache = false;
 #else
     assert(argc >= 1);
-    if (argc != 2) {
-        std::cerr << std::format("error: no input file\nusage: {} <INPUT_FILENAME>\n", argv[0]);
+    auto use_virtual_machine = false;
+    auto print_statistics = false;
+    auto optimize = false;
+    auto use_cache = false;
+    auto filename = std::string_view{};
+    for (auto i = 1; i < argc; ++i) {
+        auto const argument = std::string_view{ argv[i] };
+        if (argument == "--vm") {
+            use_virtual_machine = true;
+        } else if (argument == "-O1") {
+            optimize = true;
+        } else if (argument == "--stats") {
+            print_statistics = true;
+        } else if (argument == "--cache") {
+            use_cache = true;
+        } else if (filename.empty()) {
+            filename = argument;
+        } else {
+            filename = {};
+            break;
+        }
+    }
+    if (filename.empty()) {
+        std::cerr << std::format("error: no input file\nusage: {} [--vm] [-O1] [--stats] [--cache] <INPUT_FILENAME>\n", argv[0]);
         return EXIT_FAILURE;
     }
-    auto const filename = std::string_view{ argv[1] };
 #endif
-    auto const source = read_file(filename);
-    auto const tokens = Tokens::tokenize(filename, source);
-    auto const ast = parse(tokens);
-    interpret(ast);
+    // "-" reads the program from stdin
+    auto const is_standard_input = (filename == "-");
+    auto const source = is_standard_input ? SourceFile::read_standard_input() : SourceFile{ filename };
+    auto const display_name = is_standard_input ? std::string_view{ "<stdin>" } : filename;
+    auto arena = Arena{};
+    auto ast = statements::Statements{};
+    auto cache = std::optional<ProgramCache>{};
+    if (use_cache) {
+        auto const source_path = is_standard_input ? std::filesystem::path{} : std::filesystem::path{ filename };
+        cache.emplace(source_path, source.contents(), optimize);
+    }
+    if (auto cached = cache.has_value() ? cache->load(display_name, arena) : std::nullopt) {
+        ast = std::move(cached).value();
+    } else {
+        auto const tokens = Tokens::tokenize(display_name, source.contents());
+        ast = parse(tokens, arena);
+        if (optimize) {
+            Optimizer::optimize(ast, arena);
+        }
+        if (cache.has_value()) {
+            cache->store(ast, tokens.symbols().size());
+        }
+    }
+    Resolver::resolve(ast);
+    if (use_virtual_machine) {
+        interpret(bytecode::Compiler::compile(ast));
+    } else {
+        interpret(ast);
+    }
     std::cout << '\n';
+    if (print_statistics) {
+        auto const& statistics = values::pool::statistics();
+        std::cerr << std::format(
+                "value pool: {} allocations ({} reused), {} deallocations, {} slabs, {} oversized\n",
+                statistics.allocations,
+                statistics.reused_blocks,
+                statistics.deallocations,
+                statistics.slabs,
+                statistics.oversized_blocks
+        );
+    }
 } catch (LexerError const& error) {
     std::cerr << '\n' << error.what() << '\n';
 } catch (ParserError const& error) {
@@ -0,0 +1,60 @@
+#include "optimizer.hpp"
+#include "expressions/constant.hpp"
+#include "statements/block.hpp"
+#include "statements/break.hpp"
+#include "statements/continue.hpp"
+#include "statements/return.hpp"
+#include <iterator>
+
+[[nodiscard]] static bool is_unconditional_jump(statements::Statement const& statement) {
+    return dynamic_cast<statements::Return const*>(&statement) != nullptr
+           or dynamic_cast<statements::Break const*>(&statement) != nullptr
+           or dynamic_cast<statements::Continue const*>(&statement) != nullptr;
+}
+
+void Optimizer::optimize(statements::Statements& program, Arena& arena) {
+    auto optimizer = Optimizer{ arena };
+    optimizer.optimize(program);
+}
+
+void Optimizer::optimize(std::unique_ptr<expressions::Expression>& expression) {
+    if (auto replacement = expression->optimize(*this)) {
+        expression = std::move(replacement);
+    }
+}
+
+void Optimizer::optimize(std::unique_ptr<statements::Statement>& statement) {
+    if (auto replacement = statement->optimize(*this)) {
+        statement = std::move(replacement);
+    }
+}
+
+void Optimizer::optimize(statements::Statements& statements) {
+    for (auto i = std::size_t{ 0 }; i < statements.size(); ++i) {
+        optimize(statements.at(i));
+        if (is_unconditional_jump(*statements.at(i))) {
+            // everything after this statement is unreachable
+            statements.erase(std::next(statements.begin(), static_cast<std::ptrdiff_t>(i + 1)), statements.end());
+            return;
+        }
+    }
+}
+
+[[nodiscard]] std::unique_ptr<statements::Statement> Optimizer::make_empty_statement() {
+    return std::unique_ptr<statements::Statement>{ new (m_arena) statements::Block(statements::Statements{}) };
+}
+
+[[nodiscard]] std::unique_ptr<expressions::Expression> Optimizer::make_constant(
+        values::Value value,
+        SourceLocation const& source_location
+) {
+    // other values (e.g. ranges) have an identity and must be created on every evaluation
+    auto const is_foldable = value->is_integer_value() or value->is_bool_value() or value->is_char_value()
+                             or value->is_string_value();
+    if (not is_foldable) {
+        return nullptr;
+    }
+    return std::unique_ptr<expressions::Expression>{
+        new (m_arena) expressions::Constant(value->as_rvalue(), source_location)
+    };
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "arena.hpp"
+#include "runtime_error.hpp"
+#include "source_location.hpp"
+#include "values/value.hpp"
+#include <concepts>
+#include <memory>
+#include <vector>
+
+namespace expressions {
+    class Expression;
+}
+
+namespace statements {
+    class Statement;
+}
+
+/* The optimizer optionally runs after parsing (`-O1`). It replaces operations on constant operands
+ * by their result, removes branches that can never be taken and drops statements that follow an
+ * unconditional `return`, `break` or `continue`. Operations that would fail at runtime (e.g. division
+ * by zero or integer overflow) are not folded, so their errors are still reported when (and if) they
+ * are executed. */
+class Optimizer final {
+private:
+    Arena& m_arena;
+
+    explicit Optimizer(Arena& arena) : m_arena{ arena } { }
+
+public:
+    static void optimize(std::vector<std::unique_ptr<statements::Statement>>& program, Arena& arena);
+
+    // these replace the given node if it can be simplified
+    void optimize(std::unique_ptr<expressions::Expression>& expression);
+    void optimize(std::unique_ptr<statements::Statement>& statement);
+    void optimize(std::vector<std::unique_ptr<statements::Statement>>& statements);
+
+    // returns a constant expression holding the result of `compute()` or nullptr if it cannot be folded
+    template<std::invocable Function>
+    [[nodiscard]] std::unique_ptr<expressions::Expression> fold(
+            SourceLocation const& source_location,
+            Function&& compute
+    ) {
+        try {
+            return make_constant(compute(), source_location);
+        } catch (RuntimeError const&) {
+            return nullptr;
+        }
+    }
+
+    // replacement for statements that have no effect at all
+    [[nodiscard]] std::unique_ptr<statements::Statement> make_empty_statement();
+
+private:
+    [[nodiscard]] std::unique_ptr<expressions::Expression> make_constant(
+            values::Value value,
+            SourceLocation const& source_location
+    );
+};
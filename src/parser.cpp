@@ -37,10 +37,11 @@
 class ParserState final {
 private:
     Tokens const& m_tokens;
+    Arena& m_arena;
     std::size_t m_current_index{ 0 };
 
 public:
-    explicit ParserState(Tokens const& tokens) : m_tokens{ tokens } { }
+    ParserState(Tokens const& tokens, Arena& arena) : m_tokens{ tokens }, m_arena{ arena } { }
 
     [[nodiscard]] bool is_at_end() const {
         return m_current_index >= m_tokens.size() or m_tokens[m_current_index].type == TokenType::EndOfInput;
@@ -61,6 +62,12 @@ public:
         return m_tokens[m_current_index++];
     }
 
+    // all nodes of the syntax tree are allocated inside the arena
+    template<typename Node, typename... Args>
+    [[nodiscard]] std::unique_ptr<Node> make(Args&&... args) {
+        return std::unique_ptr<Node>{ new (m_arena) Node(std::forward<Args>(args)...) };
+    }
+
     [[nodiscard]] std::vector<std::unique_ptr<statements::Statement>> statements() {
         auto statements = statements::Statements{};
 
@@ -84,16 +91,16 @@ public:
                 advance(); // consume "="
             }
             auto end = logical_or();
-            return std::make_unique<expressions::Range>(std::move(start), end_is_inclusive, std::move(end));
+            return make<expressions::Range>(std::move(start), end_is_inclusive, std::move(end));
         }
         return start;
     }
 
     [[nodiscard]] std::unique_ptr<expressions::Expression> logical_or() { // NOLINT(misc-no-recursion)
         auto accumulator = logical_and();
-        while (current().type == TokenType::Identifier and current().lexeme() == "or") {
+        while (current().type == TokenType::Or) {
             advance(); // consume "or"
-            accumulator = std::make_unique<expressions::BinaryOperator>(
+            accumulator = make<expressions::BinaryOperator>(
                     std::move(accumulator),
                     expressions::BinaryOperator::Kind::Or,
                     logical_and()
@@ -104,9 +111,9 @@ public:
 
     [[nodiscard]] std::unique_ptr<expressions::Expression> logical_and() { // NOLINT(misc-no-recursion)
         auto accumulator = equals_or_unequals();
-        while (current().type == TokenType::Identifier and current().lexeme() == "and") {
+        while (current().type == TokenType::And) {
             advance(); // consume "and"
-            accumulator = std::make_unique<expressions::BinaryOperator>(
+            accumulator = make<expressions::BinaryOperator>(
                     std::move(accumulator),
                     expressions::BinaryOperator::Kind::And,
                     equals_or_unequals()
@@ -121,7 +128,7 @@ public:
             switch (current().type) {
                 case TokenType::EqualsEquals:
                     advance();
-                    accumulator = std::make_unique<expressions::BinaryOperator>(
+                    accumulator = make<expressions::BinaryOperator>(
                             std::move(accumulator),
                             expressions::BinaryOperator::Kind::Equality,
                             relational_operator()
@@ -129,7 +136,7 @@ public:
                     break;
                 case TokenType::ExclamationMarkEquals:
                     advance();
-                    accumulator = std::make_unique<expressions::BinaryOperator>(
+                    accumulator = make<expressions::BinaryOperator>(
                             std::move(accumulator),
                             expressions::BinaryOperator::Kind::Inequality,
                             relational_operator()
@@ -147,7 +154,7 @@ public:
             switch (current().type) {
                 case TokenType::LessThan:
                     advance();
-                    accumulator = std::make_unique<expressions::BinaryOperator>(
+                    accumulator = make<expressions::BinaryOperator>(
                             std::move(accumulator),
                             expressions::BinaryOperator::Kind::LessThan,
                             sum()
@@ -155,7 +162,7 @@ public:
                     break;
                 case TokenType::LessOrEqual:
                     advance();
-                    accumulator = std::make_unique<expressions::BinaryOperator>(
+                    accumulator = make<expressions::BinaryOperator>(
                             std::move(accumulator),
                             expressions::BinaryOperator::Kind::LessOrEqual,
                             sum()
@@ -163,7 +170,7 @@ public:
                     break;
                 case TokenType::GreaterThan:
                     advance();
-                    accumulator = std::make_unique<expressions::BinaryOperator>(
+                    accumulator = make<expressions::BinaryOperator>(
                             std::move(accumulator),
                             expressions::BinaryOperator::Kind::GreaterThan,
                             sum()
@@ -171,7 +178,7 @@ public:
                     break;
                 case TokenType::GreaterOrEqual:
                     advance();
-                    accumulator = std::make_unique<expressions::BinaryOperator>(
+                    accumulator = make<expressions::BinaryOperator>(
                             std::move(accumulator),
                             expressions::BinaryOperator::Kind::GreaterOrEqual,
                             sum()
@@ -189,7 +196,7 @@ public:
             switch (current().type) {
                 case TokenType::Plus:
                     advance();
-                    accumulator = std::make_unique<expressions::BinaryOperator>(
+                    accumulator = make<expressions::BinaryOperator>(
                             std::move(accumulator),
                             expressions::BinaryOperator::Kind::Plus,
                             product()
@@ -197,7 +204,7 @@ public:
                     break;
                 case TokenType::Minus:
                     advance();
-                    accumulator = std::make_unique<expressions::BinaryOperator>(
+                    accumulator = make<expressions::BinaryOperator>(
                             std::move(accumulator),
                             expressions::BinaryOperator::Kind::Minus,
                             product()
@@ -215,7 +222,7 @@ public:
             switch (current().type) {
                 case TokenType::Asterisk:
                     advance();
-                    accumulator = std::make_unique<expressions::BinaryOperator>(
+                    accumulator = make<expressions::BinaryOperator>(
                             std::move(accumulator),
                             expressions::BinaryOperator::Kind::Multiply,
                             unary_operator()
@@ -223,22 +230,21 @@ public:
                     break;
                 case TokenType::Slash:
                     advance();
-                    accumulator = std::make_unique<expressions::BinaryOperator>(
+                    accumulator = make<expressions::BinaryOperator>(
                             std::move(accumulator),
                             expressions::BinaryOperator::Kind::Divide,
                             unary_operator()
                     );
                     break;
+                case TokenType::Mod:
+                    advance(); // consume "mod"
+                    accumulator = make<expressions::BinaryOperator>(
+                            std::move(accumulator),
+                            expressions::BinaryOperator::Kind::Mod,
+                            unary_operator()
+                    );
+                    break;
                 default:
-                    if (current().type == TokenType::Identifier and current().lexeme() == "mod") {
-                        advance(); // consume "mod"
-                        accumulator = std::make_unique<expressions::BinaryOperator>(
-                                std::move(accumulator),
-                                expressions::BinaryOperator::Kind::Mod,
-                                unary_operator()
-                        );
-                        break;
-                    }
                     return accumulator;
             }
         }
@@ -249,7 +255,7 @@ public:
             case TokenType::Plus:
             case TokenType::Minus: {
                 auto const operator_token = advance();
-                return std::make_unique<expressions::UnaryOperator>(operator_token, postfix_operator());
+                return make<expressions::UnaryOperator>(operator_token, postfix_operator());
             }
             default:
                 return postfix_operator();
@@ -264,7 +270,7 @@ public:
                     advance(); // consume "["
                     auto index = expression();
                     auto const closing_bracket = expect(TokenType::RightSquareBracket);
-                    accumulator = std::make_unique<expressions::Subscript>(
+                    accumulator = make<expressions::Subscript>(
                             std::move(accumulator),
                             std::move(index),
                             closing_bracket
@@ -276,13 +282,13 @@ public:
                     auto arguments = std::vector<std::unique_ptr<expressions::Expression>>{};
                     if (auto const binary_operation = dynamic_cast<expressions::MemberAccess*>(accumulator.get())) {
                         arguments.push_back(binary_operation->move_lhs_out());
-                        accumulator = std::make_unique<expressions::Name>(binary_operation->member_token());
+                        accumulator = make<expressions::Name>(binary_operation->member_token());
                     }
                     for (auto& argument : expression_list(TokenType::RightParenthesis)) {
                         arguments.push_back(std::move(argument));
                     }
                     auto const closing_parenthesis = expect(TokenType::RightParenthesis);
-                    accumulator = std::make_unique<expressions::Call>(
+                    accumulator = make<expressions::Call>(
                             std::move(accumulator),
                             std::move(arguments),
                             closing_parenthesis
@@ -292,13 +298,13 @@ public:
                 case TokenType::Dot: {
                     advance(); // consume "."
                     auto const member = expect(TokenType::Identifier);
-                    accumulator = std::make_unique<expressions::MemberAccess>(std::move(accumulator), member);
+                    accumulator = make<expressions::MemberAccess>(std::move(accumulator), member);
                     break;
                 }
                 case TokenType::EqualsGreaterThan: {
                     advance(); // consume "=>"
                     auto target_type = data_type();
-                    accumulator = std::make_unique<expressions::Cast>(std::move(accumulator), std::move(target_type));
+                    accumulator = make<expressions::Cast>(std::move(accumulator), std::move(target_type));
                     break;
                 }
                 default:
@@ -310,16 +316,16 @@ public:
     [[nodiscard]] std::unique_ptr<expressions::Expression> primary() { // NOLINT(misc-no-recursion)
         switch (current().type) {
             case TokenType::StringLiteral:
-                return std::make_unique<expressions::StringLiteral>(advance());
+                return make<expressions::StringLiteral>(advance());
             case TokenType::IntegerLiteral:
-                return std::make_unique<expressions::IntegerLiteral>(advance());
+                return make<expressions::IntegerLiteral>(advance());
             case TokenType::CharLiteral:
-                return std::make_unique<expressions::CharLiteral>(advance());
+                return make<expressions::CharLiteral>(advance());
             case TokenType::LeftSquareBracket: {
                 auto const opening_bracket = advance(); // consume "["
                 auto values = expression_list(TokenType::RightSquareBracket);
                 auto const closing_bracket = advance(); // consume "]"
-                return std::make_unique<expressions::ArrayLiteral>(opening_bracket, std::move(values), closing_bracket);
+                return make<expressions::ArrayLiteral>(opening_bracket, std::move(values), closing_bracket);
             }
             case TokenType::LeftParenthesis: {
                 advance(); // consume "("
@@ -327,41 +333,41 @@ public:
                 expect(TokenType::RightParenthesis);
                 return expr;
             }
-            case TokenType::Identifier: {
-                auto const token = advance();
-                if (token.lexeme() == "true" or token.lexeme() == "false") {
-                    return std::make_unique<expressions::BoolLiteral>(token);
-                }
-                if (token.lexeme() == "typeof") {
-                    expect(TokenType::LeftParenthesis);
-                    auto expr = expression();
-                    auto const closing_parenthesis = expect(TokenType::RightParenthesis);
-                    return std::make_unique<expressions::TypeOf>(token, std::move(expr), closing_parenthesis);
-                }
-                if (token.lexeme() == "new") {
-                    // struct literal
-                    auto const struct_type_name = expect(TokenType::Identifier);
-                    expect(TokenType::LeftCurlyBracket);
-                    auto initializers = std::vector<expressions::StructMemberInitializer>{};
-                    while (not is_at_end() and current().type != TokenType::RightCurlyBracket) {
-                        auto const name = expect(TokenType::Identifier);
-                        expect(TokenType::Colon);
-                        auto value = expression();
-                        initializers.push_back(expressions::StructMemberInitializer{ name, std::move(value) });
-                        if (current().type != TokenType::Comma) {
-                            break;
-                        }
-                        advance(); // consume ","
+            case TokenType::True:
+            case TokenType::False:
+                return make<expressions::BoolLiteral>(advance());
+            case TokenType::TypeOf: {
+                auto const token = advance(); // consume "typeof"
+                expect(TokenType::LeftParenthesis);
+                auto expr = expression();
+                auto const closing_parenthesis = expect(TokenType::RightParenthesis);
+                return make<expressions::TypeOf>(token, std::move(expr), closing_parenthesis);
+            }
+            case TokenType::New: {
+                advance(); // consume "new"
+                // struct literal
+                auto const struct_type_name = expect(TokenType::Identifier);
+                expect(TokenType::LeftCurlyBracket);
+                auto initializers = std::vector<expressions::StructMemberInitializer>{};
+                while (not is_at_end() and current().type != TokenType::RightCurlyBracket) {
+                    auto const name = expect(TokenType::Identifier);
+                    expect(TokenType::Colon);
+                    auto value = expression();
+                    initializers.push_back(expressions::StructMemberInitializer{ name, std::move(value) });
+                    if (current().type != TokenType::Comma) {
+                        break;
                     }
-                    auto const closing_curly_bracket = expect(TokenType::RightCurlyBracket);
-                    return std::make_unique<expressions::StructLiteral>(
-                            struct_type_name,
-                            std::move(initializers),
-                            closing_curly_bracket
-                    );
+                    advance(); // consume ","
                 }
-                return std::make_unique<expressions::Name>(token);
+                auto const closing_curly_bracket = expect(TokenType::RightCurlyBracket);
+                return make<expressions::StructLiteral>(
+                        struct_type_name,
+                        std::move(initializers),
+                        closing_curly_bracket
+                );
             }
+            case TokenType::Identifier:
+                return make<expressions::Name>(advance());
             default:
                 throw ParserError{ UnexpectedToken{ current() } };
         }
@@ -388,6 +394,18 @@ public:
         return advance();
     }
 
+    // contextual keywords are identifiers that are only special in certain places (see symbols.hpp)
+    [[nodiscard]] bool is_contextual_keyword(SymbolId const keyword) const {
+        return current().type == TokenType::Identifier and current().symbol == keyword;
+    }
+
+    Token expect_contextual_keyword(SymbolId const keyword) {
+        if (not is_contextual_keyword(keyword)) {
+            throw ParserError{ UnexpectedToken{ current() } };
+        }
+        return advance();
+    }
+
     [[nodiscard]] std::unique_ptr<statements::Statement> block() { // NOLINT(misc-no-recursion)
         auto statements = statements::Statements{};
         expect(TokenType::LeftCurlyBracket);
@@ -395,130 +413,77 @@ public:
             statements.push_back(statement());
         }
         advance(); // consume '}'
-        return std::make_unique<statements::Block>(std::move(statements));
+        return make<statements::Block>(std::move(statements));
     }
 
     [[nodiscard]] std::unique_ptr<statements::Statement> statement() { // NOLINT(misc-no-recursion)
         switch (current().type) {
             case TokenType::LeftCurlyBracket:
                 return block();
-            case TokenType::Identifier:
-                if (current().lexeme() == "struct") {
-                    advance(); // consume "struct"
-                    auto const name = expect(TokenType::Identifier);
-                    expect(TokenType::LeftCurlyBracket);
-                    auto members = std::vector<statements::StructMember>{};
-                    while (not is_at_end() and current().type != TokenType::RightCurlyBracket) {
-                        auto const member_name = expect(TokenType::Identifier);
-                        expect(TokenType::Colon);
-                        auto member_type = data_type();
-                        members.push_back(statements::StructMember{ member_name, std::move(member_type) });
-                        if (current().type != TokenType::Comma) {
-                            break;
-                        }
-                        advance(); // consume ","
-                    }
-                    expect(TokenType::RightCurlyBracket);
-                    return std::make_unique<statements::StructDefinition>(name, std::move(members));
-                }
-                if (current().lexeme() == "function") {
-                    advance(); // consume "function"
-                    auto const name = expect(TokenType::Identifier);
-                    expect(TokenType::LeftParenthesis);
-                    auto parameters = parameter_list();
-                    expect(TokenType::RightParenthesis);
-                    auto return_type = types::make_nothing();
-                    if (current().type == TokenType::TildeArrow) {
-                        advance(); // consume "~>"
-                        return_type = data_type();
+            case TokenType::Struct: {
+                advance(); // consume "struct"
+                auto const name = expect(TokenType::Identifier);
+                expect(TokenType::LeftCurlyBracket);
+                auto members = std::vector<statements::StructMember>{};
+                while (not is_at_end() and current().type != TokenType::RightCurlyBracket) {
+                    auto const member_name = expect(TokenType::Identifier);
+                    expect(TokenType::Colon);
+                    auto member_type = data_type();
+                    members.push_back(statements::StructMember{ member_name, std::move(member_type) });
+                    if (current().type != TokenType::Comma) {
+                        break;
                     }
-                    auto body = block();
-                    return std::make_unique<statements::FunctionDefinition>(
-                            name,
-                            std::move(parameters),
-                            std::move(return_type),
-                            std::move(body)
-                    );
+                    advance(); // consume ","
                 }
-                if (current().lexeme() == "print") {
-                    advance(); // consume "print"
-                    expect(TokenType::LeftParenthesis);
-                    // clang-format off
-                    auto expr = std::unique_ptr<expressions::Expression>{
-                            current().type == TokenType::RightParenthesis ? nullptr : expression()
-                        };
-                    // clang-format on
-                    expect(TokenType::RightParenthesis);
-                    expect(TokenType::Semicolon);
-                    return std::make_unique<statements::Print>(std::move(expr));
-                }
-                if (current().lexeme() == "println") {
-                    advance(); // consume "print"
-                    expect(TokenType::LeftParenthesis);
-                    // clang-format off
-                    auto expr = std::unique_ptr<expressions::Expression>{
-                            current().type == TokenType::RightParenthesis ? nullptr : expression()
-                        };
-                    // clang-format on
-                    expect(TokenType::RightParenthesis);
-                    expect(TokenType::Semicolon);
-                    return std::make_unique<statements::Println>(std::move(expr));
-                }
-                if (current().lexeme() == "let") {
-                    advance(); // consume "let"
-                    auto name = expect(TokenType::Identifier);
-                    expect(TokenType::Equals);
-                    auto initializer = expression();
-                    expect(TokenType::Semicolon);
-                    return std::make_unique<statements::VariableDefinition>(name, std::move(initializer));
-                }
-                if (current().lexeme() == "if") {
-                    return if_();
-                }
-                if (current().lexeme() == "assert") {
-                    advance(); // consume "assert"
-                    expect(TokenType::LeftParenthesis);
-                    auto predicate = expression();
-                    expect(TokenType::RightParenthesis);
-                    expect(TokenType::Semicolon);
-                    return std::make_unique<statements::Assert>(std::move(predicate));
-                }
-                if (current().lexeme() == "while") {
-                    advance(); // consume "while"
-                    auto condition = expression();
-                    auto body = block();
-                    return std::make_unique<statements::While>(std::move(condition), std::move(body));
-                }
-                if (current().lexeme() == "break") {
-                    auto const break_token = advance();
-                    expect(TokenType::Semicolon);
-                    return std::make_unique<statements::Break>(break_token);
-                }
-                if (current().lexeme() == "continue") {
-                    auto const continue_token = advance();
-                    expect(TokenType::Semicolon);
-                    return std::make_unique<statements::Continue>(continue_token);
-                }
-                if (current().lexeme() == "return") {
-                    auto const return_token = advance();
-                    if (current().type == TokenType::Semicolon) {
-                        advance(); // consume ";"
-                        return std::make_unique<statements::Return>(return_token, std::nullopt);
-                    }
-                    auto value = expression();
-                    expect(TokenType::Semicolon);
-                    return std::make_unique<statements::Return>(return_token, std::move(value));
+                expect(TokenType::RightCurlyBracket);
+                return make<statements::StructDefinition>(name, std::move(members));
+            }
+            case TokenType::Function: {
+                advance(); // consume "function"
+                auto const name = expect(TokenType::Identifier);
+                expect(TokenType::LeftParenthesis);
+                auto parameters = parameter_list();
+                expect(TokenType::RightParenthesis);
+                auto return_type = types::make_nothing();
+                if (current().type == TokenType::TildeArrow) {
+                    advance(); // consume "~>"
+                    return_type = data_type();
                 }
-                if (current().lexeme() == "for") {
-                    advance(); // consume "for"
-                    auto const loop_variable = expect(TokenType::Identifier);
-                    if (current().type != TokenType::Identifier or current().lexeme() != "in") {
-                        throw ParserError{ UnexpectedToken{ current() } };
-                    }
-                    advance(); // consume "in"
-                    auto iterator = expression();
-                    auto body = block();
-                    return std::make_unique<statements::For>(loop_variable, std::move(iterator), std::move(body));
+                auto body = block();
+                return make<statements::FunctionDefinition>(
+                        name,
+                        std::move(parameters),
+                        std::move(return_type),
+                        std::move(body)
+                );
+            }
+            case TokenType::Let: {
+                advance(); // consume "let"
+                auto name = expect(TokenType::Identifier);
+                expect(TokenType::Equals);
+                auto initializer = expression();
+                expect(TokenType::Semicolon);
+                return make<statements::VariableDefinition>(name, std::move(initializer));
+            }
+            case TokenType::If:
+                return if_();
+            case TokenType::While: {
+                advance(); // consume "while"
+                auto condition = expression();
+                auto body = block();
+                return make<statements::While>(std::move(condition), std::move(body));
+            }
+            case TokenType::For: {
+                advance(); // consume "for"
+                auto const loop_variable = expect(TokenType::Identifier);
+                expect_contextual_keyword(symbols::in);
+                auto iterator = expression();
+                auto body = block();
+                return make<statements::For>(loop_variable, std::move(iterator), std::move(body));
+            }
+            case TokenType::Identifier:
+                if (auto keyword_statement = contextual_keyword_statement()) {
+                    return keyword_statement;
                 }
                 [[fallthrough]];
             default: {
@@ -535,7 +500,7 @@ public:
                         advance(); // consume token
                         auto rvalue = expression();
                         expect(TokenType::Semicolon);
-                        return std::make_unique<statements::Assignment>(
+                        return make<statements::Assignment>(
                                 std::move(expr),
                                 assignment_type,
                                 std::move(rvalue)
@@ -544,11 +509,72 @@ public:
                 }
                 // expression statement
                 expect(TokenType::Semicolon);
-                return std::make_unique<statements::ExpressionStatement>(std::move(expr));
+                return make<statements::ExpressionStatement>(std::move(expr));
             }
         }
     }
 
+    // returns nullptr if the current token is no contextual keyword that starts a statement
+    [[nodiscard]] std::unique_ptr<statements::Statement> contextual_keyword_statement() { // NOLINT(misc-no-recursion)
+        assert(current().type == TokenType::Identifier);
+        switch (current().symbol) {
+            case symbols::print: {
+                advance(); // consume "print"
+                expect(TokenType::LeftParenthesis);
+                // clang-format off
+                auto expr = std::unique_ptr<expressions::Expression>{
+                        current().type == TokenType::RightParenthesis ? nullptr : expression()
+                    };
+                // clang-format on
+                expect(TokenType::RightParenthesis);
+                expect(TokenType::Semicolon);
+                return make<statements::Print>(std::move(expr));
+            }
+            case symbols::println: {
+                advance(); // consume "print"
+                expect(TokenType::LeftParenthesis);
+                // clang-format off
+                auto expr = std::unique_ptr<expressions::Expression>{
+                        current().type == TokenType::RightParenthesis ? nullptr : expression()
+                    };
+                // clang-format on
+                expect(TokenType::RightParenthesis);
+                expect(TokenType::Semicolon);
+                return make<statements::Println>(std::move(expr));
+            }
+            case symbols::assert_: {
+                advance(); // consume "assert"
+                expect(TokenType::LeftParenthesis);
+                auto predicate = expression();
+                expect(TokenType::RightParenthesis);
+                expect(TokenType::Semicolon);
+                return make<statements::Assert>(std::move(predicate));
+            }
+            case symbols::break_: {
+                auto const break_token = advance();
+                expect(TokenType::Semicolon);
+                return make<statements::Break>(break_token);
+            }
+            case symbols::continue_: {
+                auto const continue_token = advance();
+                expect(TokenType::Semicolon);
+                return make<statements::Continue>(continue_token);
+            }
+            case symbols::return_: {
+                auto const return_token = advance();
+                if (current().type == TokenType::Semicolon) {
+                    advance(); // consume ";"
+                    return make<statements::Return>(return_token, std::nullopt);
+                }
+                auto value = expression();
+                expect(TokenType::Semicolon);
+                return make<statements::Return>(return_token, std::move(value));
+            }
+            default:
+                return nullptr;
+        }
+    }
+
     [[nodiscard]] std::vector<statements::FunctionParameter> parameter_list() {
         auto parameters = std::vector<statements::FunctionParameter>{};
         while (current().type == TokenType::Identifier) {
@@ -565,22 +591,22 @@ public:
     }
 
     [[nodiscard]] std::unique_ptr<statements::Statement> if_() { // NOLINT(misc-no-recursion)
-        assert(current().type == TokenType::Identifier and current().lexeme() == "if");
+        assert(current().type == TokenType::If);
         auto const if_token = advance(); // consume "if"
         auto condition = expression();
         auto then = block();
-        if (current().type == TokenType::Identifier and current().lexeme() == "else") {
+        if (is_contextual_keyword(symbols::else_)) {
             advance(); // consume "else"
-            if (current().type == TokenType::Identifier and current().lexeme() == "if") {
-                return std::make_unique<statements::If>(if_token, std::move(condition), std::move(then), if_());
+            if (current().type == TokenType::If) {
+                return make<statements::If>(if_token, std::move(condition), std::move(then), if_());
             }
-            return std::make_unique<statements::If>(if_token, std::move(condition), std::move(then), block());
+            return make<statements::If>(if_token, std::move(condition), std::move(then), block());
         }
-        return std::make_unique<statements::If>(
+        return make<statements::If>(
                 if_token,
                 std::move(condition),
                 std::move(then),
-                std::make_unique<statements::Block>(statements::Statements{})
+                make<statements::Block>(statements::Statements{})
         );
     }
 
@@ -648,7 +674,7 @@ public:
     }
 };
 
-[[nodiscard]] statements::Statements parse(Tokens const& tokens) {
-    auto state = ParserState{ tokens };
+[[nodiscard]] statements::Statements parse(Tokens const& tokens, Arena& arena) {
+    auto state = ParserState{ tokens, arena };
     return statements::Statements{ state.statements() };
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "arena.hpp"
 #include "expressions/expression.hpp"
 #include "lexer.hpp"
 #include "statements/statement.hpp"
@@ -7,4 +8,4 @@
 #include <variant>
 #include <vector>
 
-[[nodiscard]] statements::Statements parse(Tokens const& tokens);
+[[nodiscard]] statements::Statements parse(Tokens const& tokens, Arena& arena);
@@ -10,7 +10,7 @@ private:
 
 public:
     explicit UnexpectedToken(Token token) {
-        m_message = std::format("{}: unexpected token '{}'", token.source_location, token);
+        m_message = std::format("{}: unexpected token '{}'", token.source_location(), token);
     }
 
     friend class ParserError;
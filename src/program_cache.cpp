@@ -0,0 +1,123 @@
+#include "program_cache.hpp"
+#include "program_image.hpp"
+#include "source_file.hpp"
+#include "source_table.hpp"
+#include <bit>
+#include <cstdlib>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <random>
+#include <system_error>
+
+namespace {
+    // "LASZLOIM" in little endian byte order
+    constexpr auto image_magic = std::uint64_t{ 0x4d494f4c5a53414c };
+    constexpr auto header_size = std::size_t{ 4 * sizeof(std::uint64_t) };
+
+    // not suitable against deliberate collisions, but much faster than a cryptographic hash
+    [[nodiscard]] std::uint64_t hash(std::string_view const data, std::uint64_t seed) {
+        constexpr auto multiplier = std::uint64_t{ 0x9e3779b97f4a7c15 };
+        auto const mix = [&](std::uint64_t const word) {
+            seed = std::rotl((seed ^ word) * multiplier, 31) * multiplier;
+        };
+        auto i = std::size_t{ 0 };
+        for (; i + sizeof(std::uint64_t) <= data.length(); i += sizeof(std::uint64_t)) {
+            auto word = std::uint64_t{};
+            std::memcpy(&word, data.data() + i, sizeof(word));
+            mix(word);
+        }
+        if (i < data.length()) {
+            auto tail = std::uint64_t{ 0 };
+            std::memcpy(&tail, data.data() + i, data.length() - i);
+            mix(tail);
+        }
+        mix(data.length());
+        return seed ^ (seed >> 29);
+    }
+
+    [[nodiscard]] std::filesystem::path image_path(
+            std::filesystem::path const& source_path,
+            std::uint64_t const key
+    ) {
+        if (auto const cache_directory = std::getenv("LASZLO_CACHE_DIR")) {
+            return std::filesystem::path{ cache_directory } / std::format("{:016x}.lasc", key);
+        }
+        if (source_path.empty()) {
+            return {};
+        }
+        auto result = source_path;
+        result.replace_extension(".lasc");
+        return result;
+    }
+} // namespace
+
+ProgramCache::ProgramCache(std::filesystem::path const& source_path, std::string_view const source, bool const optimize)
+    : m_source{ source },
+      m_key{ hash(source, (image_format_version << 1) | (optimize ? 1 : 0)) },
+      m_image_path{ image_path(source_path, m_key) } { }
+
+[[nodiscard]] std::optional<statements::Statements> ProgramCache::load(
+        std::string_view const filename,
+        Arena& arena
+) const {
+    if (m_image_path.empty()) {
+        return std::nullopt;
+    }
+    try {
+        auto const image = SourceFile{ m_image_path };
+        auto const contents = image.contents();
+
+        // the header is checked before the source gets registered
+        auto header = ImageReader{ contents.substr(0, header_size), 0, 0, arena };
+        if (header.read_u64() != image_magic or header.read_u64() != m_key or header.read_u64() != m_source.length()) {
+            return std::nullopt;
+        }
+        auto const body = contents.substr(header_size);
+        if (header.read_u64() != hash(body, 0)) {
+            // corrupted image
+            return std::nullopt;
+        }
+
+        auto const first_offset = SourceTable::instance().add(filename, m_source);
+        auto reader = ImageReader{ body, first_offset, m_source.length(), arena };
+        auto program = reader.read_program();
+        if (not reader.is_at_end()) {
+            return std::nullopt;
+        }
+        return program;
+    } catch (std::exception const&) {
+        // missing or invalid image
+        return std::nullopt;
+    }
+}
+
+void ProgramCache::store(statements::Statements const& program, std::size_t const num_symbols) const {
+    if (m_image_path.empty()) {
+        return;
+    }
+    auto body = ImageWriter{};
+    body.write_program(program, num_symbols);
+    auto writer = ImageWriter{};
+    writer.write_u64(image_magic);
+    writer.write_u64(m_key);
+    writer.write_u64(m_source.length());
+    writer.write_u64(hash(body.data(), 0));
+
+    // other processes may read the image at the same time, so it is replaced atomically
+    auto temporary_path = m_image_path;
+    temporary_path += std::format(".{:08x}.tmp", std::random_device{}());
+    auto file = std::ofstream{ temporary_path, std::ios::binary };
+    file.write(writer.data().data(), static_cast<std::streamsize>(writer.data().length()));
+    file.write(body.data().data(), static_cast<std::streamsize>(body.data().length()));
+    file.close();
+    auto error = std::error_code{};
+    if (not file) {
+        std::filesystem::remove(temporary_path, error);
+        return;
+    }
+    std::filesystem::rename(temporary_path, m_image_path, error);
+    if (error) {
+        std::filesystem::remove(temporary_path, error);
+    }
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "arena.hpp"
+#include "statements/statement.hpp"
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string_view>
+
+/* Stores parsed (and possibly optimized) programs as program images (see program_image.hpp), so
+ * that running an unchanged script again skips lexing and parsing. An image is only used if it
+ * has the current image format (see `image_format_version`) and was written for the same source
+ * code and optimization level.
+ * Images are stored next to the source file (with the extension `.lasc`) or, if the environment
+ * variable `LASZLO_CACHE_DIR` is set, inside of that directory. Missing or invalid images are
+ * silently ignored, just like failures to write them. */
+class ProgramCache final {
+private:
+    std::string_view m_source;
+    std::uint64_t m_key;
+    std::filesystem::path m_image_path; // empty if the program cannot be cached
+
+public:
+    // an empty source path means that the source has been read from stdin
+    ProgramCache(std::filesystem::path const& source_path, std::string_view source, bool optimize);
+
+    // the filename is used for the source locations of the loaded program
+    [[nodiscard]] std::optional<statements::Statements> load(std::string_view filename, Arena& arena) const;
+
+    // `num_symbols` is the size of the symbol table of the program (see `Tokens::symbols()`)
+    void store(statements::Statements const& program, std::size_t num_symbols) const;
+};
@@ -0,0 +1,429 @@
+#include "program_image.hpp"
+#include "expressions/array_literal.hpp"
+#include "expressions/binary_operator.hpp"
+#include "expressions/bool_literal.hpp"
+#include "expressions/call.hpp"
+#include "expressions/cast.hpp"
+#include "expressions/char_literal.hpp"
+#include "expressions/constant.hpp"
+#include "expressions/integer_literal.hpp"
+#include "expressions/member_access.hpp"
+#include "expressions/name.hpp"
+#include "expressions/range.hpp"
+#include "expressions/string_literal.hpp"
+#include "expressions/struct_literal.hpp"
+#include "expressions/subscript.hpp"
+#include "expressions/typeof.hpp"
+#include "expressions/unary_operator.hpp"
+#include "source_table.hpp"
+#include "statements/assert.hpp"
+#include "statements/assignment.hpp"
+#include "statements/block.hpp"
+#include "statements/break.hpp"
+#include "statements/continue.hpp"
+#include "statements/expression_statement.hpp"
+#include "statements/for.hpp"
+#include "statements/function_definition.hpp"
+#include "statements/if.hpp"
+#include "statements/print.hpp"
+#include "statements/println.hpp"
+#include "statements/return.hpp"
+#include "statements/struct_definition.hpp"
+#include "statements/variable_definition.hpp"
+#include "statements/while.hpp"
+#include "values/bool.hpp"
+#include "values/char.hpp"
+#include "values/integer.hpp"
+#include "values/string.hpp"
+
+namespace {
+    enum class ValueTag : std::uint8_t {
+        Integer,
+        Bool,
+        Char,
+        String,
+    };
+} // namespace
+
+void ImageWriter::write_byte(std::uint8_t const value) {
+    m_data.push_back(static_cast<char>(value));
+}
+
+// integers are stored in little endian byte order
+void ImageWriter::write_u32(std::uint32_t const value) {
+    for (auto i = 0; i < 4; ++i) {
+        write_byte(static_cast<std::uint8_t>(value >> (8 * i)));
+    }
+}
+
+void ImageWriter::write_u64(std::uint64_t const value) {
+    for (auto i = 0; i < 8; ++i) {
+        write_byte(static_cast<std::uint8_t>(value >> (8 * i)));
+    }
+}
+
+void ImageWriter::write_bool(bool const value) {
+    write_byte(value ? 1 : 0);
+}
+
+void ImageWriter::write_string(std::string_view const value) {
+    write_u64(value.length());
+    m_data.append(value);
+}
+
+void ImageWriter::write_tag(NodeTag const tag) {
+    write_enum(tag);
+}
+
+void ImageWriter::write_token(Token const& token) {
+    write_u32(static_cast<std::uint32_t>(token.source_location().byte_offset));
+    write_u32(token.length);
+    write_enum(token.type);
+    write_u32(token.symbol);
+}
+
+void ImageWriter::write_source_location(SourceLocation const& source_location) {
+    write_u32(static_cast<std::uint32_t>(source_location.byte_offset));
+    write_u32(static_cast<std::uint32_t>(source_location.num_bytes));
+}
+
+void ImageWriter::write_type(types::Type const type) { // NOLINT(misc-no-recursion)
+    write_enum(type->kind());
+    switch (type->kind()) {
+        case types::Kind::I32:
+        case types::Kind::Char:
+        case types::Kind::Bool:
+        case types::Kind::String:
+        case types::Kind::Range:
+        case types::Kind::Unspecified:
+        case types::Kind::Nothing:
+            break;
+        case types::Kind::Array:
+            write_type(type->as_array().contained_type());
+            break;
+        case types::Kind::Function: {
+            auto const& function = type->as_function();
+            write_u64(function.parameter_types().size());
+            for (auto const parameter_type : function.parameter_types()) {
+                write_type(parameter_type);
+            }
+            write_type(function.return_type());
+            break;
+        }
+        default:
+            // the parser never creates any other types
+            assert(false and "unreachable");
+            break;
+    }
+}
+
+void ImageWriter::write_value(values::Value const& value) {
+    // the optimizer only folds these kinds of values (see `Optimizer::make_constant()`)
+    if (value->is_integer_value()) {
+        write_enum(ValueTag::Integer);
+        write_u32(static_cast<std::uint32_t>(value->as_integer_value()));
+    } else if (value->is_bool_value()) {
+        write_enum(ValueTag::Bool);
+        write_bool(value->as_bool_value());
+    } else if (value->is_char_value()) {
+        write_enum(ValueTag::Char);
+        write_byte(value->as_char_value());
+    } else {
+        assert(value->is_string_value());
+        write_enum(ValueTag::String);
+        write_string(value->as_string().value());
+    }
+}
+
+void ImageWriter::write_expression(expressions::Expression const& expression) {
+    expression.serialize(*this);
+}
+
+void ImageWriter::write_optional_expression(expressions::Expression const* const expression) {
+    write_bool(expression != nullptr);
+    if (expression != nullptr) {
+        write_expression(*expression);
+    }
+}
+
+void ImageWriter::write_expressions(std::vector<std::unique_ptr<expressions::Expression>> const& expressions) {
+    write_u64(expressions.size());
+    for (auto const& expression : expressions) {
+        write_expression(*expression);
+    }
+}
+
+void ImageWriter::write_statement(statements::Statement const& statement) {
+    statement.serialize(*this);
+}
+
+void ImageWriter::write_optional_statement(statements::Statement const* const statement) {
+    write_bool(statement != nullptr);
+    if (statement != nullptr) {
+        write_statement(*statement);
+    }
+}
+
+void ImageWriter::write_statements(statements::Statements const& statements) {
+    write_u64(statements.size());
+    for (auto const& statement : statements) {
+        write_statement(*statement);
+    }
+}
+
+void ImageWriter::write_program(statements::Statements const& program, std::size_t const num_symbols) {
+    write_u64(num_symbols);
+    write_statements(program);
+}
+
+ImageReader::ImageReader(
+        std::string_view const data,
+        std::uint32_t const first_offset,
+        std::size_t const source_length,
+        Arena& arena
+)
+    : m_data{ data },
+      m_first_offset{ first_offset },
+      m_source_length{ source_length },
+      m_arena{ arena } { }
+
+[[nodiscard]] std::uint8_t ImageReader::read_byte() {
+    return static_cast<std::uint8_t>(read_bytes(1).front());
+}
+
+[[nodiscard]] std::uint32_t ImageReader::read_u32() {
+    auto const bytes = read_bytes(4);
+    auto result = std::uint32_t{ 0 };
+    for (auto i = 0; i < 4; ++i) {
+        result |= static_cast<std::uint32_t>(static_cast<std::uint8_t>(bytes[i])) << (8 * i);
+    }
+    return result;
+}
+
+[[nodiscard]] std::uint64_t ImageReader::read_u64() {
+    auto const bytes = read_bytes(8);
+    auto result = std::uint64_t{ 0 };
+    for (auto i = 0; i < 8; ++i) {
+        result |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(bytes[i])) << (8 * i);
+    }
+    return result;
+}
+
+[[nodiscard]] bool ImageReader::read_bool() {
+    auto const value = read_byte();
+    if (value > 1) {
+        throw InvalidImage{};
+    }
+    return value == 1;
+}
+
+[[nodiscard]] std::string_view ImageReader::read_string() {
+    auto const length = read_u64();
+    if (length > m_data.length()) {
+        throw InvalidImage{};
+    }
+    return read_bytes(static_cast<std::size_t>(length));
+}
+
+[[nodiscard]] Token ImageReader::read_token() {
+    auto const byte_offset = read_u32();
+    auto const length = read_u32();
+    auto const type = read_enum(TokenType::EndOfInput);
+    auto const symbol = read_u32();
+    if (length > Token::max_length) {
+        throw InvalidImage{};
+    }
+    // only identifiers have a symbol, and it has to be part of the symbol table of the program
+    auto const is_valid_symbol =
+            (type == TokenType::Identifier ? symbol < m_num_symbols : symbol == symbols::none);
+    if (not is_valid_symbol) {
+        throw InvalidImage{};
+    }
+    return Token{ type, global_offset(byte_offset, length), length, symbol };
+}
+
+[[nodiscard]] SourceLocation ImageReader::read_source_location() {
+    auto const byte_offset = read_u32();
+    auto const num_bytes = read_u32();
+    return SourceTable::instance().location(global_offset(byte_offset, num_bytes), num_bytes);
+}
+
+[[nodiscard]] types::Type ImageReader::read_type() { // NOLINT(misc-no-recursion)
+    switch (read_enum(types::Kind::StructType)) {
+        case types::Kind::I32:
+            return types::make_i32();
+        case types::Kind::Char:
+            return types::make_char();
+        case types::Kind::Bool:
+            return types::make_bool();
+        case types::Kind::String:
+            return types::make_string();
+        case types::Kind::Range:
+            return types::make_range();
+        case types::Kind::Unspecified:
+            return types::make_unspecified();
+        case types::Kind::Nothing:
+            return types::make_nothing();
+        case types::Kind::Array:
+            return types::make_array(read_type());
+        case types::Kind::Function: {
+            auto const num_parameters = read_u64();
+            auto parameter_types = std::vector<types::Type>{};
+            for (auto i = std::uint64_t{ 0 }; i < num_parameters; ++i) {
+                parameter_types.push_back(read_type());
+            }
+            auto const return_type = read_type();
+            return types::make_function(parameter_types, return_type);
+        }
+        default:
+            throw InvalidImage{};
+    }
+}
+
+[[nodiscard]] values::Value ImageReader::read_value() {
+    switch (read_enum(ValueTag::String)) {
+        case ValueTag::Integer:
+            return values::Integer::make(static_cast<std::int32_t>(read_u32()), values::ValueCategory::Rvalue);
+        case ValueTag::Bool:
+            return values::Bool::make(read_bool(), values::ValueCategory::Rvalue);
+        case ValueTag::Char:
+            return values::Char::make(read_byte(), values::ValueCategory::Rvalue);
+        case ValueTag::String:
+            return values::String::make(std::string{ read_string() }, values::ValueCategory::Rvalue);
+    }
+    throw InvalidImage{};
+}
+
+[[nodiscard]] std::unique_ptr<expressions::Expression> ImageReader::read_expression() { // NOLINT(misc-no-recursion)
+    switch (read_enum(NodeTag::UnaryOperator)) {
+        case NodeTag::ArrayLiteral:
+            return expressions::ArrayLiteral::deserialize(*this);
+        case NodeTag::BinaryOperator:
+            return expressions::BinaryOperator::deserialize(*this);
+        case NodeTag::BoolLiteral:
+            return expressions::BoolLiteral::deserialize(*this);
+        case NodeTag::Call:
+            return expressions::Call::deserialize(*this);
+        case NodeTag::Cast:
+            return expressions::Cast::deserialize(*this);
+        case NodeTag::CharLiteral:
+            return expressions::CharLiteral::deserialize(*this);
+        case NodeTag::Constant:
+            return expressions::Constant::deserialize(*this);
+        case NodeTag::IntegerLiteral:
+            return expressions::IntegerLiteral::deserialize(*this);
+        case NodeTag::MemberAccess:
+            return expressions::MemberAccess::deserialize(*this);
+        case NodeTag::Name:
+            return expressions::Name::deserialize(*this);
+        case NodeTag::Range:
+            return expressions::Range::deserialize(*this);
+        case NodeTag::StringLiteral:
+            return expressions::StringLiteral::deserialize(*this);
+        case NodeTag::StructLiteral:
+            return expressions::StructLiteral::deserialize(*this);
+        case NodeTag::Subscript:
+            return expressions::Subscript::deserialize(*this);
+        case NodeTag::TypeOf:
+            return expressions::TypeOf::deserialize(*this);
+        case NodeTag::UnaryOperator:
+            return expressions::UnaryOperator::deserialize(*this);
+        default:
+            // a statement
+            throw InvalidImage{};
+    }
+}
+
+[[nodiscard]] std::unique_ptr<expressions::Expression> ImageReader::read_optional_expression() {
+    return read_bool() ? read_expression() : nullptr;
+}
+
+[[nodiscard]] std::vector<std::unique_ptr<expressions::Expression>> ImageReader::read_expressions() {
+    auto const count = read_u64();
+    auto result = std::vector<std::unique_ptr<expressions::Expression>>{};
+    for (auto i = std::uint64_t{ 0 }; i < count; ++i) {
+        result.push_back(read_expression());
+    }
+    return result;
+}
+
+[[nodiscard]] std::unique_ptr<statements::Statement> ImageReader::read_statement() { // NOLINT(misc-no-recursion)
+    switch (read_enum(NodeTag::While)) {
+        case NodeTag::Assert:
+            return statements::Assert::deserialize(*this);
+        case NodeTag::Assignment:
+            return statements::Assignment::deserialize(*this);
+        case NodeTag::Block:
+            return statements::Block::deserialize(*this);
+        case NodeTag::Break:
+            return statements::Break::deserialize(*this);
+        case NodeTag::Continue:
+            return statements::Continue::deserialize(*this);
+        case NodeTag::ExpressionStatement:
+            return statements::ExpressionStatement::deserialize(*this);
+        case NodeTag::For:
+            return statements::For::deserialize(*this);
+        case NodeTag::FunctionDefinition:
+            return statements::FunctionDefinition::deserialize(*this);
+        case NodeTag::If:
+            return statements::If::deserialize(*this);
+        case NodeTag::Print:
+            return statements::Print::deserialize(*this);
+        case NodeTag::Println:
+            return statements::Println::deserialize(*this);
+        case NodeTag::Return:
+            return statements::Return::deserialize(*this);
+        case NodeTag::StructDefinition:
+            return statements::StructDefinition::deserialize(*this);
+        case NodeTag::VariableDefinition:
+            return statements::VariableDefinition::deserialize(*this);
+        case NodeTag::While:
+            return statements::While::deserialize(*this);
+        default:
+            // an expression
+            throw InvalidImage{};
+    }
+}
+
+[[nodiscard]] std::unique_ptr<statements::Statement> ImageReader::read_optional_statement() {
+    return read_bool() ? read_statement() : nullptr;
+}
+
+[[nodiscard]] statements::Statements ImageReader::read_statements() {
+    auto const count = read_u64();
+    auto result = statements::Statements{};
+    for (auto i = std::uint64_t{ 0 }; i < count; ++i) {
+        result.push_back(read_statement());
+    }
+    return result;
+}
+
+[[nodiscard]] statements::Statements ImageReader::read_program() {
+    auto const num_symbols = read_u64();
+    if (num_symbols > symbols::none) {
+        throw InvalidImage{};
+    }
+    m_num_symbols = static_cast<std::size_t>(num_symbols);
+    return read_statements();
+}
+
+[[nodiscard]] std::string_view ImageReader::read_bytes(std::size_t const count) {
+    if (count > m_data.length() - m_position) {
+        throw InvalidImage{};
+    }
+    auto const result = m_data.substr(m_position, count);
+    m_position += count;
+    return result;
+}
+
+// converts an offset within the source file into a global offset (see source_table.hpp)
+[[nodiscard]] std::uint32_t ImageReader::global_offset(
+        std::uint32_t const byte_offset,
+        std::uint32_t const num_bytes
+) const {
+    // the end of input token of an empty file points one past its end
+    if (static_cast<std::uint64_t>(byte_offset) + num_bytes > m_source_length + 1) {
+        throw InvalidImage{};
+    }
+    return m_first_offset + byte_offset;
+}
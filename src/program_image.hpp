@@ -0,0 +1,156 @@
+#pragma once
+
+#include "arena.hpp"
+#include "expressions/expression.hpp"
+#include "source_location.hpp"
+#include "statements/statement.hpp"
+#include "token.hpp"
+#include "types.hpp"
+#include "values/value.hpp"
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/* A program image is the binary form of a parsed (and possibly optimized) syntax tree, it is used
+ * by the program cache (see program_cache.hpp). Every node writes a tag followed by its contents
+ * (`serialize()`), the reader dispatches on the tag to the `deserialize()` function of the node.
+ * Tokens and source locations are stored relative to the start of their source file, which has
+ * to be available (unchanged) when the image is read. The results of the resolver are not part of
+ * the image. */
+
+/* Identifies the image format. It has to be incremented with every change to what gets written,
+ * including the numbering of enums that are stored in images (like `TokenType` or `types::Kind`).
+ * Images of other versions are never loaded. */
+inline constexpr auto image_format_version = std::uint64_t{ 2 };
+
+// the tags are part of the image format, new ones must only be appended
+enum class NodeTag : std::uint8_t {
+    ArrayLiteral,
+    BinaryOperator,
+    BoolLiteral,
+    Call,
+    Cast,
+    CharLiteral,
+    Constant,
+    IntegerLiteral,
+    MemberAccess,
+    Name,
+    Range,
+    StringLiteral,
+    StructLiteral,
+    Subscript,
+    TypeOf,
+    UnaryOperator,
+    Assert,
+    Assignment,
+    Block,
+    Break,
+    Continue,
+    ExpressionStatement,
+    For,
+    FunctionDefinition,
+    If,
+    Print,
+    Println,
+    Return,
+    StructDefinition,
+    VariableDefinition,
+    While,
+};
+
+// thrown by the reader if the image is malformed
+class InvalidImage final : public std::runtime_error {
+public:
+    InvalidImage() : std::runtime_error{ "invalid program image" } { }
+};
+
+class ImageWriter final {
+private:
+    std::string m_data;
+
+public:
+    [[nodiscard]] std::string const& data() const {
+        return m_data;
+    }
+
+    void write_byte(std::uint8_t value);
+    void write_u32(std::uint32_t value);
+    void write_u64(std::uint64_t value);
+    void write_bool(bool value);
+    void write_string(std::string_view value);
+    void write_tag(NodeTag tag);
+    void write_token(Token const& token);
+    void write_source_location(SourceLocation const& source_location);
+    void write_type(types::Type type);
+    void write_value(values::Value const& value);
+    void write_expression(expressions::Expression const& expression);
+    void write_optional_expression(expressions::Expression const* expression);
+    void write_expressions(std::vector<std::unique_ptr<expressions::Expression>> const& expressions);
+    void write_statement(statements::Statement const& statement);
+    void write_optional_statement(statements::Statement const* statement);
+    void write_statements(statements::Statements const& statements);
+    // `num_symbols` is the size of the symbol table the tokens of the program refer to
+    void write_program(statements::Statements const& program, std::size_t num_symbols);
+
+    template<typename Enum>
+    void write_enum(Enum const value) {
+        write_byte(static_cast<std::uint8_t>(value));
+    }
+};
+
+class ImageReader final {
+private:
+    std::string_view m_data;
+    std::size_t m_position{ 0 };
+    std::uint32_t m_first_offset; // the global offset of the source file (see source_table.hpp)
+    std::size_t m_source_length;
+    std::size_t m_num_symbols{ 0 }; // read by `read_program()`
+    Arena& m_arena;
+
+public:
+    ImageReader(std::string_view data, std::uint32_t first_offset, std::size_t source_length, Arena& arena);
+
+    [[nodiscard]] bool is_at_end() const {
+        return m_position == m_data.length();
+    }
+
+    [[nodiscard]] std::uint8_t read_byte();
+    [[nodiscard]] std::uint32_t read_u32();
+    [[nodiscard]] std::uint64_t read_u64();
+    [[nodiscard]] bool read_bool();
+    [[nodiscard]] std::string_view read_string();
+    [[nodiscard]] Token read_token();
+    [[nodiscard]] SourceLocation read_source_location();
+    [[nodiscard]] types::Type read_type();
+    [[nodiscard]] values::Value read_value();
+    [[nodiscard]] std::unique_ptr<expressions::Expression> read_expression();
+    [[nodiscard]] std::unique_ptr<expressions::Expression> read_optional_expression(); // nullptr if absent
+    [[nodiscard]] std::vector<std::unique_ptr<expressions::Expression>> read_expressions();
+    [[nodiscard]] std::unique_ptr<statements::Statement> read_statement();
+    [[nodiscard]] std::unique_ptr<statements::Statement> read_optional_statement(); // nullptr if absent
+    [[nodiscard]] statements::Statements read_statements();
+    [[nodiscard]] statements::Statements read_program();
+
+    // reads an enumerator of an enum whose enumerators are numbered from 0 to `last`
+    template<typename Enum>
+    [[nodiscard]] Enum read_enum(Enum const last) {
+        auto const value = read_byte();
+        if (value > static_cast<std::uint8_t>(last)) {
+            throw InvalidImage{};
+        }
+        return static_cast<Enum>(value);
+    }
+
+    // see `ParserState::make()`
+    template<typename Node, typename... Args>
+    [[nodiscard]] std::unique_ptr<Node> make(Args&&... args) {
+        return std::unique_ptr<Node>{ new (m_arena) Node(std::forward<Args>(args)...) };
+    }
+
+private:
+    [[nodiscard]] std::string_view read_bytes(std::size_t count);
+    [[nodiscard]] std::uint32_t global_offset(std::uint32_t byte_offset, std::uint32_t num_bytes) const;
+};
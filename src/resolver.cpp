@@ -0,0 +1,98 @@
+#include "resolver.hpp"
+#include "builtin_function_type.hpp"
+#include "statements/statement.hpp"
+#include <algorithm>
+#include <cassert>
+
+void Resolver::resolve(statements::Statements& program) {
+    auto resolver = Resolver{};
+
+    // first pass: determine which names are defined where
+    resolver.reset();
+    for (auto const& statement : program) {
+        statement->resolve(resolver);
+    }
+    resolver.m_global_names = resolver.m_scopes.front();
+
+    // second pass: annotate all references
+    resolver.m_pass = Pass::ResolveNames;
+    resolver.reset();
+    for (auto const& statement : program) {
+        statement->resolve(resolver);
+    }
+}
+
+[[nodiscard]] Address Resolver::lookup(SymbolId const name) const {
+    if (m_pass == Pass::CollectDefinitions) {
+        return Address::dynamic();
+    }
+
+    auto const visible_scopes_start = m_function_scopes.empty() ? std::size_t{ 0 } : m_function_scopes.back();
+    for (auto i = m_scopes.size(); i > visible_scopes_start; --i) {
+        auto const& scope = m_scopes.at(i - 1);
+        auto const find_iterator = std::find(scope.cbegin(), scope.cend(), name);
+        if (find_iterator == scope.cend()) {
+            continue;
+        }
+        auto const slot = static_cast<std::uint32_t>(std::distance(scope.cbegin(), find_iterator));
+        if (i == 1) {
+            return Address::global(slot);
+        }
+        return Address::local(static_cast<std::uint32_t>(m_scopes.size() - i), slot);
+    }
+
+    if (m_function_scopes.empty() or (name < m_is_local_name.size() and m_is_local_name[name])) {
+        return Address::dynamic();
+    }
+
+    auto const find_iterator = std::find(m_global_names.cbegin(), m_global_names.cend(), name);
+    if (find_iterator == m_global_names.cend()) {
+        return Address::dynamic();
+    }
+    return Address::global(static_cast<std::uint32_t>(std::distance(m_global_names.cbegin(), find_iterator)));
+}
+
+[[nodiscard]] Resolver::Definition Resolver::define(SymbolId const name) {
+    auto& scope = m_scopes.back();
+    auto const slot = static_cast<std::uint32_t>(scope.size());
+    if (std::find(scope.cbegin(), scope.cend(), name) != scope.cend()) {
+        return Definition{ slot, true };
+    }
+    if (m_pass == Pass::CollectDefinitions and m_scopes.size() > 1) {
+        if (name >= m_is_local_name.size()) {
+            m_is_local_name.resize(name + 1);
+        }
+        m_is_local_name[name] = true;
+    }
+    scope.push_back(name);
+    return Definition{ slot, false };
+}
+
+void Resolver::push_scope() {
+    m_scopes.emplace_back();
+}
+
+void Resolver::pop_scope() {
+    assert(m_scopes.size() > 1);
+    m_scopes.pop_back();
+}
+
+void Resolver::begin_function() {
+    m_function_scopes.push_back(m_scopes.size());
+    push_scope();
+}
+
+void Resolver::end_function() {
+    assert(not m_function_scopes.empty());
+    m_scopes.resize(m_function_scopes.back());
+    m_function_scopes.pop_back();
+}
+
+void Resolver::reset() {
+    m_scopes.clear();
+    m_scopes.emplace_back();
+    for (auto const type : builtin_function_types) {
+        m_scopes.front().push_back(symbols::builtin_function(type));
+    }
+    m_function_scopes.clear();
+}
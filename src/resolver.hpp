@@ -0,0 +1,57 @@
+#pragma once
+
+#include "scope.hpp"
+#include "symbols.hpp"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace statements {
+    class Statement;
+}
+
+/* The resolver runs after parsing and annotates every variable reference and definition with
+ * the address it will have at runtime. It mirrors the scopes that get pushed by the interpreter:
+ * within a function body (and on the top level) the layout of all scopes is known statically.
+ * Since Laszlo uses dynamic scoping, names that are not found within the current function
+ * either resolve to a global variable (if no other scope can ever contain a variable with that
+ * name) or have to be looked up dynamically. */
+class Resolver final {
+public:
+    struct Definition final {
+        std::uint32_t slot;
+        bool is_redefinition;
+    };
+
+private:
+    enum class Pass {
+        CollectDefinitions,
+        ResolveNames,
+    };
+
+    Pass m_pass{ Pass::CollectDefinitions };
+    std::vector<std::vector<SymbolId>> m_scopes; // the first one is the global scope
+    std::vector<std::size_t> m_function_scopes;  // indices into `m_scopes`
+    std::vector<bool> m_is_local_name;           // indexed by symbol, set for names defined in any non-global scope
+    std::vector<SymbolId> m_global_names;        // the final layout of the global scope
+
+    Resolver() = default;
+
+public:
+    static void resolve(std::vector<std::unique_ptr<statements::Statement>>& program);
+
+    [[nodiscard]] Address lookup(SymbolId name) const;
+
+    // defines the name inside the innermost scope
+    [[nodiscard]] Definition define(SymbolId name);
+
+    void push_scope();
+    void pop_scope();
+
+    // pushes the scope that will contain the function parameters
+    void begin_function();
+    void end_function();
+
+private:
+    void reset();
+};
@@ -3,6 +3,7 @@
 #include "token.hpp"
 #include "types.hpp"
 #include <concepts>
+#include <cstdint>
 #include <format>
 #include <numeric>
 #include <stdexcept>
@@ -58,19 +59,19 @@ public:
 class SymbolRedefinition final : public RuntimeError {
 public:
     explicit SymbolRedefinition(Token const& token)
-        : RuntimeError{ std::format("{}: redefinition of symbol '{}'", token.source_location, token.lexeme()) } { }
+        : RuntimeError{ std::format("{}: redefinition of symbol '{}'", token.source_location(), token.lexeme()) } { }
 };
 
 class UndefinedReference final : public RuntimeError {
 public:
     explicit UndefinedReference(Token const& token)
-        : RuntimeError{ std::format("{}: undefined reference to name '{}'", token.source_location, token.lexeme()) } { }
+        : RuntimeError{ std::format("{}: undefined reference to name '{}'", token.source_location(), token.lexeme()) } { }
 };
 
 class UnknownType final : public RuntimeError {
 public:
     explicit UnknownType(Token const& token)
-        : RuntimeError{ std::format("{}: '{}' does not name a type", token.source_location, token.lexeme()) } { }
+        : RuntimeError{ std::format("{}: '{}' does not name a type", token.source_location(), token.lexeme()) } { }
 };
 
 class TypeMismatch final : public RuntimeError {
@@ -119,6 +120,17 @@ public:
         : RuntimeError{ std::format("index '{}' is out of bounds for array of size '{}'", index, size) } { }
 };
 
+class PopFromEmptyArray final : public RuntimeError {
+public:
+    PopFromEmptyArray() : RuntimeError{ "unable to pop from an empty array" } { }
+};
+
+class NegativeCapacity final : public RuntimeError {
+public:
+    NegativeCapacity(std::string_view const function_name, std::int32_t const capacity)
+        : RuntimeError{ std::format("{}: capacity must not be negative (got {})", function_name, capacity) } { }
+};
+
 class InvalidValueCast final : public RuntimeError {
 public:
     explicit InvalidValueCast(std::string_view const target_type)
@@ -135,7 +147,7 @@ public:
     WrongNumberOfArguments(Token const& function_name, std::size_t const expected_count, std::size_t const actual_count)
         : RuntimeError{ std::format(
                   "{}: wrong number of arguments when calling function '{}' (expected {}, got {})",
-                  function_name.source_location,
+                  function_name.source_location(),
                   function_name.lexeme(),
                   expected_count,
                   actual_count
@@ -159,7 +171,7 @@ public:
     WrongArgumentType(Token const& parameter_name, types::Type const& expected, types::Type const& actual)
         : RuntimeError{ std::format(
                   "{}: wrong argument type (expected '{}', got '{}')",
-                  parameter_name.source_location,
+                  parameter_name.source_location(),
                   expected->to_string(),
                   actual->to_string()
           ) } { }
@@ -182,7 +194,7 @@ public:
     NoSuchMember(types::Type const& type, Token const& member)
         : RuntimeError{ std::format(
                   "{}: type '{}' has no member named '{}'",
-                  member.source_location,
+                  member.source_location(),
                   type->to_string(),
                   member.lexeme()
           ) } { }
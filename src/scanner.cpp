@@ -0,0 +1,96 @@
+#include "scanner.hpp"
+#include <bit>
+
+#if defined(__SSE2__) or defined(_M_X64)
+#include <emmintrin.h>
+#define LASZLO_SCANNER_SSE2
+#endif
+
+namespace scanner {
+    namespace {
+#ifdef LASZLO_SCANNER_SSE2
+        constexpr auto block_size = std::size_t{ 16 };
+
+        [[nodiscard]] __m128i load(std::string_view const source, std::size_t const position) {
+            return _mm_loadu_si128(reinterpret_cast<__m128i const*>(source.data() + position));
+        }
+
+        [[nodiscard]] __m128i splat(char const c) {
+            return _mm_set1_epi8(c);
+        }
+
+        // all bytes that are within [first, last], bytes >= 0x80 never are (since the comparisons are signed)
+        [[nodiscard]] __m128i in_range(__m128i const bytes, char const first, char const last) {
+            return _mm_and_si128(
+                    _mm_cmpgt_epi8(bytes, splat(static_cast<char>(first - 1))),
+                    _mm_cmplt_epi8(bytes, splat(static_cast<char>(last + 1)))
+            );
+        }
+
+        // one bit per byte of the block, set for every byte that belongs to the run
+        [[nodiscard]] unsigned whitespace_mask(__m128i const bytes) {
+            auto const matches = _mm_or_si128(_mm_cmpeq_epi8(bytes, splat(' ')), in_range(bytes, '\t', '\r'));
+            return static_cast<unsigned>(_mm_movemask_epi8(matches));
+        }
+
+        [[nodiscard]] unsigned digit_mask(__m128i const bytes) {
+            return static_cast<unsigned>(_mm_movemask_epi8(in_range(bytes, '0', '9')));
+        }
+
+        [[nodiscard]] unsigned identifier_continuation_mask(__m128i const bytes) {
+            // setting bit 5 maps uppercase letters onto lowercase ones and nothing else onto letters
+            auto const letters = in_range(_mm_or_si128(bytes, splat(static_cast<char>(0x20))), 'a', 'z');
+            auto const matches = _mm_or_si128(
+                    _mm_or_si128(letters, in_range(bytes, '0', '9')),
+                    _mm_cmpeq_epi8(bytes, splat('_'))
+            );
+            return static_cast<unsigned>(_mm_movemask_epi8(matches));
+        }
+#else
+        // only the scalar loop is used
+        constexpr auto whitespace_mask = nullptr;
+        constexpr auto digit_mask = nullptr;
+        constexpr auto identifier_continuation_mask = nullptr;
+#endif
+
+        template<typename BlockMask, typename IsMember>
+        [[nodiscard]] std::size_t skip(
+                std::string_view const source,
+                std::size_t position,
+                [[maybe_unused]] BlockMask const& block_mask,
+                IsMember const& is_member
+        ) {
+#ifdef LASZLO_SCANNER_SSE2
+            while (position + block_size <= source.length()) {
+                auto const non_members = ~block_mask(load(source, position)) & 0xFFFFu;
+                if (non_members != 0) {
+                    return position + static_cast<std::size_t>(std::countr_zero(non_members));
+                }
+                position += block_size;
+            }
+#endif
+            while (position < source.length() and is_member(source[position])) {
+                ++position;
+            }
+            return position;
+        }
+    } // namespace
+
+    [[nodiscard]] std::size_t skip_whitespace(std::string_view const source, std::size_t const position) {
+        return skip(source, position, whitespace_mask, is_whitespace);
+    }
+
+    [[nodiscard]] std::size_t skip_digits(std::string_view const source, std::size_t const position) {
+        return skip(source, position, digit_mask, is_digit);
+    }
+
+    [[nodiscard]] std::size_t skip_identifier_continuation(std::string_view const source, std::size_t const position) {
+        return skip(source, position, identifier_continuation_mask, is_identifier_continuation);
+    }
+
+    [[nodiscard]] std::size_t find(std::string_view const source, std::size_t const position, char const c) {
+        // `memchr()` (used by `std::string_view::find()`) is vectorized by the standard library
+        auto const result = source.find(c, position);
+        return result == std::string_view::npos ? source.length() : result;
+    }
+} // namespace scanner
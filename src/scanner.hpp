@@ -0,0 +1,66 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+/* Helpers for the lexer that find the end of a run of characters of the same class. Where SSE2 is
+ * available (which is always the case on x86-64), they examine 16 bytes at a time, otherwise one
+ * byte at a time. All of them return `source.length()` if the run reaches the end of the source. */
+namespace scanner {
+    namespace detail {
+        enum CharClass : std::uint8_t {
+            Whitespace = 1 << 0,
+            Digit = 1 << 1,
+            IdentifierStart = 1 << 2,
+        };
+
+        [[nodiscard]] consteval std::array<std::uint8_t, 256> make_char_classes() {
+            auto result = std::array<std::uint8_t, 256>{};
+            // same as `std::isspace()` in the "C" locale
+            for (auto const c : std::string_view{ " \t\n\v\f\r" }) {
+                result[static_cast<unsigned char>(c)] |= Whitespace;
+            }
+            for (auto c = '0'; c <= '9'; ++c) {
+                result[static_cast<unsigned char>(c)] |= Digit;
+            }
+            for (auto c = 'a'; c <= 'z'; ++c) {
+                result[static_cast<unsigned char>(c)] |= IdentifierStart;
+                result[static_cast<unsigned char>(c - 'a' + 'A')] |= IdentifierStart;
+            }
+            result[static_cast<unsigned char>('_')] |= IdentifierStart;
+            return result;
+        }
+
+        inline constexpr auto char_classes = make_char_classes();
+
+        [[nodiscard]] constexpr bool has_class(char const c, std::uint8_t const char_class) {
+            return (char_classes[static_cast<unsigned char>(c)] & char_class) != 0;
+        }
+    } // namespace detail
+
+    [[nodiscard]] constexpr bool is_whitespace(char const c) {
+        return detail::has_class(c, detail::Whitespace);
+    }
+
+    [[nodiscard]] constexpr bool is_digit(char const c) {
+        return detail::has_class(c, detail::Digit);
+    }
+
+    [[nodiscard]] constexpr bool is_identifier_start(char const c) {
+        return detail::has_class(c, detail::IdentifierStart);
+    }
+
+    [[nodiscard]] constexpr bool is_identifier_continuation(char const c) {
+        return detail::has_class(c, detail::IdentifierStart | detail::Digit);
+    }
+
+    // these return the position of the first character (at or after `position`) that does not belong to the run
+    [[nodiscard]] std::size_t skip_whitespace(std::string_view source, std::size_t position);
+    [[nodiscard]] std::size_t skip_digits(std::string_view source, std::size_t position);
+    [[nodiscard]] std::size_t skip_identifier_continuation(std::string_view source, std::size_t position);
+
+    // returns the position of the first occurrence of `c` at or after `position`
+    [[nodiscard]] std::size_t find(std::string_view source, std::size_t position, char c);
+} // namespace scanner
@@ -1,61 +1,130 @@
 #pragma once
 
+#include "symbols.hpp"
 #include "values/value.hpp"
-#include <list>
-#include <string>
-#include <unordered_map>
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <iterator>
+#include <vector>
 
-using Scope = std::unordered_map<std::string, values::Value>;
+// The location of a variable as determined by the resolver.
+struct Address final {
+    enum class Kind : std::uint8_t {
+        Dynamic, // has to be looked up by name at runtime
+        Local,   // `slot` inside the scope that is `depth` scopes below the top of the scope stack
+        Global,  // `slot` inside the global scope
+    };
 
-class ScopeStack {
+    Kind kind{ Kind::Dynamic };
+    std::uint32_t depth{ 0 };
+    std::uint32_t slot{ 0 };
+
+    [[nodiscard]] static constexpr Address dynamic() {
+        return Address{};
+    }
+
+    [[nodiscard]] static constexpr Address local(std::uint32_t const depth, std::uint32_t const slot) {
+        return Address{ Kind::Local, depth, slot };
+    }
+
+    [[nodiscard]] static constexpr Address global(std::uint32_t const slot) {
+        return Address{ Kind::Global, 0, slot };
+    }
+};
+
+/* All variables that are currently alive are stored in one contiguous stack of slots, in the order
+ * of their definition. This order is the same as the one the resolver assumes, so a variable can be
+ * accessed by the slot index relative to the start of its scope. Pushing a scope only records where
+ * it starts, and truncating the stack destroys the contiguous tail of slots that belong to the
+ * removed scopes. The names are only needed for dynamic lookups. */
+class ScopeStack final {
 private:
-    /* It's not possible to use an std::vector<Scope> here since MSVC's standard library
-     * implementation of std::unordered_map doesn't seem to have its constructors marked
-     * noexcept.
-     * todo: review if this is now possible that we use std::shared_ptr instead of std::unique_ptr
-     */
-    std::list<Scope> m_scopes;
+    std::vector<SymbolId> m_names;
+    std::vector<values::Value> m_values;
+    std::vector<std::size_t> m_scope_starts; // the first slot of each scope, the first one is the global scope
 
 public:
     ScopeStack() {
-        m_scopes.emplace_back();
+        m_scope_starts.push_back(0);
     }
 
-    [[nodiscard]] Scope& top() {
-        return m_scopes.back();
+    // the number of variables inside the innermost scope
+    [[nodiscard]] std::size_t top_size() const {
+        return m_values.size() - m_scope_starts.back();
     }
 
-    [[nodiscard]] Scope const& top() const {
-        return m_scopes.back();
+    [[nodiscard]] bool top_contains(SymbolId const name) const {
+        auto const first = std::next(m_names.cbegin(), static_cast<std::ptrdiff_t>(m_scope_starts.back()));
+        return std::find(first, m_names.cend(), name) != m_names.cend();
     }
 
-    void push(Scope scope) {
-        m_scopes.push_back(std::move(scope));
+    /* Inserts into the innermost scope. Returns `false` (without inserting) if there already is a
+     * variable with the given name in that scope. */
+    [[nodiscard]] bool insert(SymbolId const name, values::Value value) {
+        if (top_contains(name)) {
+            return false;
+        }
+        append(name, std::move(value));
+        return true;
     }
 
-    [[nodiscard]] Scope pop() {
-        auto result = std::move(m_scopes.back());
-        m_scopes.pop_back();
-        return result;
+    // inserts into the innermost scope without checking for redefinitions (which the resolver already did)
+    void append(SymbolId const name, values::Value value) {
+        m_names.push_back(name);
+        m_values.push_back(std::move(value));
     }
 
-    [[nodiscard]] values::Value* lookup(std::string const& name) {
-        // todo: refactor return value to tl::optional<Value&>
-        for (auto scope_iterator = m_scopes.rbegin(); scope_iterator != m_scopes.rend(); ++scope_iterator) {
-            auto find_iterator = scope_iterator->find(name);
-            if (find_iterator != scope_iterator->end()) {
-                return &find_iterator->second;
+    // pushes a new (empty) innermost scope
+    void push() {
+        m_scope_starts.push_back(m_values.size());
+    }
+
+    // The returned pointer is only valid until the next variable gets defined.
+    [[nodiscard]] values::Value* lookup(SymbolId const name) {
+        // names are unique within each scope, so the last definition is the one in the innermost scope
+        for (auto i = m_names.size(); i > 0; --i) {
+            if (m_names[i - 1] == name) {
+                return &m_values[i - 1];
             }
         }
         return nullptr;
     }
 
+    // The returned pointer is only valid until the next variable gets defined.
+    [[nodiscard]] values::Value* lookup(Address const address, SymbolId const name) {
+        switch (address.kind) {
+            case Address::Kind::Local: {
+                assert(address.depth < m_scope_starts.size());
+                auto const index = m_scope_starts[m_scope_starts.size() - 1 - address.depth] + address.slot;
+                assert(index < m_values.size());
+                return &m_values[index];
+            }
+            case Address::Kind::Global: {
+                // the global variable may not have been defined yet
+                auto const global_scope_size = m_scope_starts.size() > 1 ? m_scope_starts[1] : m_values.size();
+                return address.slot < global_scope_size ? &m_values[address.slot] : nullptr;
+            }
+            case Address::Kind::Dynamic:
+                break;
+        }
+        return lookup(name);
+    }
+
+    // the number of scopes (including the global scope)
     [[nodiscard]] std::size_t size() const {
-        return m_scopes.size();
+        return m_scope_starts.size();
     }
 
+    // removes all scopes (and their variables) except for the first `length` ones
     void truncate(std::size_t const length) {
-        assert(length <= m_scopes.size());
-        m_scopes.resize(length);
+        assert(length > 0 and length <= m_scope_starts.size());
+        if (length == m_scope_starts.size()) {
+            return;
+        }
+        auto const num_slots = m_scope_starts[length];
+        m_scope_starts.resize(length);
+        m_names.resize(num_slots);
+        m_values.resize(num_slots);
     }
 };
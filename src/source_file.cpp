@@ -0,0 +1,73 @@
+#include "source_file.hpp"
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+
+#ifdef LASZLO_SOURCE_FILE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+[[nodiscard]] static std::string read_all(std::istream& stream) {
+    return std::string{ std::istreambuf_iterator<char>{ stream }, std::istreambuf_iterator<char>{} };
+}
+
+SourceFile::SourceFile(std::filesystem::path const& path) {
+    if (try_to_map(path)) {
+        return;
+    }
+    auto file = std::ifstream{ path };
+    if (not file) {
+        throw std::runtime_error{ std::format("unable to open file '{}'", path.string()) };
+    }
+    m_buffer = read_all(file);
+    m_contents = m_buffer;
+}
+
+SourceFile::~SourceFile() {
+#ifdef LASZLO_SOURCE_FILE_MMAP
+    if (m_mapping != nullptr) {
+        ::munmap(m_mapping, m_mapping_size);
+    }
+#endif
+}
+
+SourceFile::SourceFile(std::istream& stream) : m_buffer{ read_all(stream) }, m_contents{ m_buffer } { }
+
+[[nodiscard]] SourceFile SourceFile::read_standard_input() {
+    return SourceFile{ std::cin };
+}
+
+#ifdef LASZLO_SOURCE_FILE_MMAP
+[[nodiscard]] bool SourceFile::try_to_map(std::filesystem::path const& path) {
+    auto const file_descriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (file_descriptor < 0) {
+        return false;
+    }
+    // the mapping stays valid after the file has been closed
+    struct stat status {};
+    auto const is_mappable = ::fstat(file_descriptor, &status) == 0 and S_ISREG(status.st_mode) and status.st_size > 0;
+    auto mapping = MAP_FAILED;
+    if (is_mappable) {
+        mapping = ::mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+    }
+    ::close(file_descriptor);
+    if (mapping == MAP_FAILED) {
+        return false;
+    }
+    // the lexer reads the source from front to back exactly once
+    ::madvise(mapping, static_cast<std::size_t>(status.st_size), MADV_SEQUENTIAL);
+    m_mapping = mapping;
+    m_mapping_size = static_cast<std::size_t>(status.st_size);
+    m_contents = std::string_view{ static_cast<char const*>(mapping), m_mapping_size };
+    return true;
+}
+#else
+[[nodiscard]] bool SourceFile::try_to_map([[maybe_unused]] std::filesystem::path const& path) {
+    return false;
+}
+#endif
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <istream>
+#include <string>
+#include <string_view>
+
+#if (defined(__unix__) or defined(__APPLE__)) and not defined(EMSCRIPTEN)
+#define LASZLO_SOURCE_FILE_MMAP
+#endif
+
+/* The contents of a source file. Regular files are mapped into memory (read-only) where this is
+ * supported, so that the tokens, the AST and all source locations refer directly to the page cache.
+ * Everything else (e.g. pipes or stdin) is read into a buffer instead. Since the contents may live
+ * inside of this object, it can neither be copied nor moved. */
+class SourceFile final {
+private:
+    std::string m_buffer;       // only used if the file is not mapped
+    void* m_mapping{ nullptr }; // the start of the mapping, if any
+    std::size_t m_mapping_size{ 0 };
+    std::string_view m_contents;
+
+    explicit SourceFile(std::istream& stream);
+
+public:
+    explicit SourceFile(std::filesystem::path const& path);
+    SourceFile(SourceFile const&) = delete;
+    SourceFile(SourceFile&&) = delete;
+    SourceFile& operator=(SourceFile const&) = delete;
+    SourceFile& operator=(SourceFile&&) = delete;
+    ~SourceFile();
+
+    [[nodiscard]] static SourceFile read_standard_input();
+
+    [[nodiscard]] std::string_view contents() const {
+        return m_contents;
+    }
+
+private:
+    [[nodiscard]] bool try_to_map(std::filesystem::path const& path);
+};
@@ -1,18 +1,45 @@
 #pragma once
 
 #include "ostream_formatter.hpp"
+#include "scanner.hpp"
+#include <algorithm>
 #include <cassert>
 #include <cstdlib>
 #include <filesystem>
 #include <iostream>
+#include <iterator>
 #include <string_view>
 #include <utility>
+#include <vector>
 
 struct Token;
 
+// The byte offsets at which the lines of a source file start. The source table creates this once per file.
+class LineStarts final {
+private:
+    std::vector<std::size_t> m_offsets;
+
+public:
+    explicit LineStarts(std::string_view const source) {
+        m_offsets.push_back(0);
+        for (auto i = scanner::find(source, 0, '\n'); i < source.length(); i = scanner::find(source, i + 1, '\n')) {
+            m_offsets.push_back(i + 1);
+        }
+    }
+
+    // both line and column are 1-based
+    [[nodiscard]] std::pair<std::size_t, std::size_t> line_and_column(std::size_t const byte_offset) const {
+        // the first line start after the offset, there always is at least one line start before it
+        auto const next_line_start = std::upper_bound(m_offsets.cbegin(), m_offsets.cend(), byte_offset);
+        auto const line = static_cast<std::size_t>(std::distance(m_offsets.cbegin(), next_line_start));
+        return { line, byte_offset - *std::prev(next_line_start) + 1 };
+    }
+};
+
 struct SourceLocation {
     std::string_view filename;
     std::string_view source;
+    LineStarts const* line_starts; // owned by the source table (see source_table.hpp)
     std::size_t byte_offset;
     std::size_t num_bytes;
 
@@ -22,22 +49,13 @@ struct SourceLocation {
         auto const start_offset = first.byte_offset;
         auto const end_offset = last.byte_offset + last.num_bytes;
         auto const num_bytes = end_offset - start_offset;
-        return SourceLocation{ first.filename, first.source, start_offset, num_bytes };
+        return SourceLocation{ first.filename, first.source, first.line_starts, start_offset, num_bytes };
     }
 
     [[nodiscard]] std::pair<std::size_t, std::size_t> line_and_column() const {
         assert(byte_offset < source.length());
-        auto line = std::size_t{ 1 };
-        auto column = std::size_t{ 1 };
-        for (std::size_t i = 0; i < byte_offset; ++i) {
-            if (source.at(i) == '\n') {
-                ++line;
-                column = 1;
-            } else {
-                ++column;
-            }
-        }
-        return { line, column };
+        assert(line_starts != nullptr);
+        return line_starts->line_and_column(byte_offset);
     }
 
     [[nodiscard]] std::string_view text() const {
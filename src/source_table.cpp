@@ -0,0 +1,46 @@
+#include "source_table.hpp"
+#include <algorithm>
+#include <cassert>
+#include <format>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+
+[[nodiscard]] SourceTable& SourceTable::instance() {
+    static auto table = SourceTable{};
+    return table;
+}
+
+[[nodiscard]] std::uint32_t SourceTable::add(std::string_view const filename, std::string_view const source) {
+    // one additional offset for the end of input, so that even empty files have a distinct range
+    auto const num_offsets = static_cast<std::uint64_t>(source.length()) + 1;
+    if (num_offsets > std::numeric_limits<std::uint32_t>::max() - m_next_offset) {
+        throw std::runtime_error{ std::format("source file '{}' exceeds the maximum total source size", filename) };
+    }
+    auto const first_offset = m_next_offset;
+    m_files.push_back(std::make_unique<File const>(filename, source, first_offset));
+    m_next_offset += static_cast<std::uint32_t>(num_offsets);
+    return first_offset;
+}
+
+[[nodiscard]] SourceLocation SourceTable::location(std::uint32_t const offset, std::uint32_t const num_bytes) const {
+    auto const& file = this->file(offset);
+    return SourceLocation{ file.filename, file.source, &file.line_starts, offset - file.first_offset, num_bytes };
+}
+
+[[nodiscard]] std::string_view SourceTable::text(std::uint32_t const offset, std::uint32_t const num_bytes) const {
+    auto const& file = this->file(offset);
+    return file.source.substr(offset - file.first_offset, num_bytes);
+}
+
+[[nodiscard]] SourceTable::File const& SourceTable::file(std::uint32_t const offset) const {
+    assert(not m_files.empty() and offset < m_next_offset);
+    // the first file that starts after the offset, the one before it contains the offset
+    auto const next_file = std::upper_bound(
+            m_files.cbegin(),
+            m_files.cend(),
+            offset,
+            [](std::uint32_t const value, std::unique_ptr<File const> const& file) { return value < file->first_offset; }
+    );
+    return **std::prev(next_file);
+}
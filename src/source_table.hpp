@@ -0,0 +1,46 @@
+#pragma once
+
+#include "source_location.hpp"
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+/* All source files of a run share one 32-bit offset space: every file registered here gets the next
+ * free range of offsets. Tokens only store such an offset and a length, their full source location
+ * (filename, line and column) is looked up here when it is actually needed (e.g. for diagnostics).
+ * The filenames and sources must outlive the table. */
+class SourceTable final {
+private:
+    struct File final {
+        std::string_view filename;
+        std::string_view source;
+        LineStarts line_starts;
+        std::uint32_t first_offset;
+
+        File(std::string_view const filename, std::string_view const source, std::uint32_t const first_offset)
+            : filename{ filename },
+              source{ source },
+              line_starts{ source },
+              first_offset{ first_offset } { }
+    };
+
+    // sorted by their first offset, the source locations refer to the line starts of the files
+    std::vector<std::unique_ptr<File const>> m_files;
+    std::uint32_t m_next_offset{ 0 };
+
+    SourceTable() = default;
+
+public:
+    [[nodiscard]] static SourceTable& instance();
+
+    // returns the global offset of the first byte of the added file
+    [[nodiscard]] std::uint32_t add(std::string_view filename, std::string_view source);
+
+    [[nodiscard]] SourceLocation location(std::uint32_t offset, std::uint32_t num_bytes) const;
+
+    [[nodiscard]] std::string_view text(std::uint32_t offset, std::uint32_t num_bytes) const;
+
+private:
+    [[nodiscard]] File const& file(std::uint32_t offset) const;
+};
@@ -1,6 +1,10 @@
 #pragma once
 
 #include "../values/bool.hpp"
+#include "../bytecode/compiler.hpp"
+#include "../optimizer.hpp"
+#include "../program_image.hpp"
+#include "../resolver.hpp"
 #include "statement.hpp"
 
 namespace statements {
@@ -11,14 +15,38 @@ namespace statements {
     public:
         explicit Assert(std::unique_ptr<expressions::Expression> expression) : m_expression{ std::move(expression) } { }
 
-        void execute(ScopeStack& scope_stack) const override {
-            auto const evaluated = m_expression->evaluate(scope_stack);
+        [[nodiscard]] Completion execute(ScopeStack& scope_stack) const override {
+            auto const evaluated = m_expression->load(scope_stack);
             if (not evaluated->is_bool_value()) {
                 throw TypeMismatch{ m_expression->source_location(), types::make_bool(), evaluated->type() };
             }
-            if (not evaluated->as_bool_value().value()) {
+            if (not evaluated->as_bool_value()) {
                 throw FailedAssertion{ m_expression->source_location() };
             }
+            return Completion::normal();
+        }
+
+        void compile(bytecode::Compiler& compiler) const override {
+            m_expression->compile_load(compiler);
+            compiler.emit(bytecode::OpCode::Assert, 0, m_expression->source_location());
+        }
+
+        void resolve(Resolver& resolver) override {
+            m_expression->resolve(resolver);
+        }
+
+        [[nodiscard]] std::unique_ptr<Statement> optimize(Optimizer& optimizer) override {
+            optimizer.optimize(m_expression);
+            return nullptr;
+        }
+
+        void serialize(ImageWriter& writer) const override {
+            writer.write_tag(NodeTag::Assert);
+            writer.write_expression(*m_expression);
+        }
+
+        [[nodiscard]] static std::unique_ptr<Statement> deserialize(ImageReader& reader) {
+            return reader.make<Assert>(reader.read_expression());
         }
     };
 } // namespace statements
@@ -1,5 +1,9 @@
 #pragma once
 
+#include "../bytecode/compiler.hpp"
+#include "../optimizer.hpp"
+#include "../program_image.hpp"
+#include "../resolver.hpp"
 #include "statement.hpp"
 
 namespace statements {
@@ -28,36 +32,88 @@ namespace statements {
               m_type{ type },
               m_rvalue{ std::move(rvalue) } { }
 
-        void execute(ScopeStack& scope_stack) const override {
+        [[nodiscard]] Completion execute(ScopeStack& scope_stack) const override {
             switch (m_type) {
                 case Type::Equals:
-                    m_lvalue->evaluate(scope_stack)->assign(m_rvalue->evaluate(scope_stack));
+                    m_lvalue->evaluate(scope_stack)->assign(m_rvalue->load(scope_stack));
                     break;
-                case Type::Plus: {
-                    auto const new_value =
-                            m_lvalue->evaluate(scope_stack)->binary_plus(m_rvalue->evaluate(scope_stack));
-                    m_lvalue->evaluate(scope_stack)->assign(new_value);
+                case Type::Plus:
+                    // arrays are appended to in place
+                    m_lvalue->evaluate(scope_stack)->add_assign(m_rvalue->load(scope_stack));
                     break;
-                }
                 case Type::Minus: {
                     auto const new_value =
-                            m_lvalue->evaluate(scope_stack)->binary_minus(m_rvalue->evaluate(scope_stack));
+                            m_lvalue->evaluate(scope_stack)->binary_minus(m_rvalue->load(scope_stack));
                     m_lvalue->evaluate(scope_stack)->assign(new_value);
                     break;
                 }
                 case Type::Asterisk: {
-                    auto const new_value = m_lvalue->evaluate(scope_stack)->multiply(m_rvalue->evaluate(scope_stack));
+                    auto const new_value = m_lvalue->evaluate(scope_stack)->multiply(m_rvalue->load(scope_stack));
                     m_lvalue->evaluate(scope_stack)->assign(new_value);
                     break;
                 }
                 case Type::Slash: {
-                    auto const new_value = m_lvalue->evaluate(scope_stack)->divide(m_rvalue->evaluate(scope_stack));
+                    auto const new_value = m_lvalue->evaluate(scope_stack)->divide(m_rvalue->load(scope_stack));
                     m_lvalue->evaluate(scope_stack)->assign(new_value);
                     break;
                 }
                 default:
                     throw std::runtime_error{ "unreachable" };
             }
+            return Completion::normal();
+        }
+
+        void compile(bytecode::Compiler& compiler) const override {
+            if (m_type == Type::Equals or m_type == Type::Plus) {
+                m_lvalue->compile(compiler);
+                m_rvalue->compile_load(compiler);
+                compiler.emit(m_type == Type::Equals ? bytecode::OpCode::Assign : bytecode::OpCode::AddAssign);
+                return;
+            }
+            m_lvalue->compile(compiler);
+            m_rvalue->compile_load(compiler);
+            switch (m_type) {
+                case Type::Minus:
+                    compiler.emit(bytecode::OpCode::Subtract);
+                    break;
+                case Type::Asterisk:
+                    compiler.emit(bytecode::OpCode::Multiply);
+                    break;
+                case Type::Slash:
+                    compiler.emit(bytecode::OpCode::Divide);
+                    break;
+                default:
+                    throw std::runtime_error{ "unreachable" };
+            }
+            // the target is evaluated a second time, just like in `execute()`
+            m_lvalue->compile(compiler);
+            compiler.emit(bytecode::OpCode::Swap);
+            compiler.emit(bytecode::OpCode::Assign);
+        }
+
+        void resolve(Resolver& resolver) override {
+            m_lvalue->resolve(resolver);
+            m_rvalue->resolve(resolver);
+        }
+
+        [[nodiscard]] std::unique_ptr<Statement> optimize(Optimizer& optimizer) override {
+            optimizer.optimize(m_lvalue);
+            optimizer.optimize(m_rvalue);
+            return nullptr;
+        }
+
+        void serialize(ImageWriter& writer) const override {
+            writer.write_tag(NodeTag::Assignment);
+            writer.write_expression(*m_lvalue);
+            writer.write_enum(m_type);
+            writer.write_expression(*m_rvalue);
+        }
+
+        [[nodiscard]] static std::unique_ptr<Statement> deserialize(ImageReader& reader) {
+            auto lvalue = reader.read_expression();
+            auto const type = reader.read_enum(Type::Slash);
+            auto rvalue = reader.read_expression();
+            return reader.make<Assignment>(std::move(lvalue), type, std::move(rvalue));
         }
     };
 } // namespace statements
@@ -1,5 +1,9 @@
 #pragma once
 
+#include "../bytecode/compiler.hpp"
+#include "../optimizer.hpp"
+#include "../program_image.hpp"
+#include "../resolver.hpp"
 #include "statement.hpp"
 
 namespace statements {
@@ -10,13 +14,48 @@ namespace statements {
     public:
         explicit Block(Statements statements) : m_statements{ std::move(statements) } { }
 
-        void execute(ScopeStack& scope_stack) const override {
+        [[nodiscard]] Completion execute(ScopeStack& scope_stack) const override {
             auto const num_scopes = scope_stack.size();
-            scope_stack.push(Scope{});
+            scope_stack.push();
             for (auto const& statement : m_statements) {
-                statement->execute(scope_stack);
+                auto completion = statement->execute(scope_stack);
+                if (not completion.is_normal()) {
+                    scope_stack.truncate(num_scopes);
+                    return completion;
+                }
             }
             scope_stack.truncate(num_scopes);
+            return Completion::normal();
+        }
+
+        void compile(bytecode::Compiler& compiler) const override {
+            compiler.push_scope();
+            for (auto const& statement : m_statements) {
+                statement->compile(compiler);
+            }
+            compiler.pop_scope();
+        }
+
+        void resolve(Resolver& resolver) override {
+            resolver.push_scope();
+            for (auto const& statement : m_statements) {
+                statement->resolve(resolver);
+            }
+            resolver.pop_scope();
+        }
+
+        [[nodiscard]] std::unique_ptr<Statement> optimize(Optimizer& optimizer) override {
+            optimizer.optimize(m_statements);
+            return nullptr;
+        }
+
+        void serialize(ImageWriter& writer) const override {
+            writer.write_tag(NodeTag::Block);
+            writer.write_statements(m_statements);
+        }
+
+        [[nodiscard]] static std::unique_ptr<Statement> deserialize(ImageReader& reader) {
+            return reader.make<Block>(reader.read_statements());
         }
     };
 } // namespace statements
@@ -1,6 +1,10 @@
 #pragma once
 
 #include "../control_flow.hpp"
+#include "../bytecode/compiler.hpp"
+#include "../optimizer.hpp"
+#include "../program_image.hpp"
+#include "../resolver.hpp"
 #include "statement.hpp"
 
 namespace statements {
@@ -11,8 +15,27 @@ namespace statements {
     public:
         explicit Break(Token const& break_token) : m_break_token{ break_token } { }
 
-        void execute(ScopeStack& scope_stack) const override {
-            throw BreakException{ m_break_token };
+        [[nodiscard]] Completion execute(ScopeStack& scope_stack) const override {
+            return Completion::break_(m_break_token);
+        }
+
+        void compile(bytecode::Compiler& compiler) const override {
+            compiler.emit_break(m_break_token);
+        }
+
+        void resolve([[maybe_unused]] Resolver& resolver) override { }
+
+        [[nodiscard]] std::unique_ptr<Statement> optimize([[maybe_unused]] Optimizer& optimizer) override {
+            return nullptr;
+        }
+
+        void serialize(ImageWriter& writer) const override {
+            writer.write_tag(NodeTag::Break);
+            writer.write_token(m_break_token);
+        }
+
+        [[nodiscard]] static std::unique_ptr<Statement> deserialize(ImageReader& reader) {
+            return reader.make<Break>(reader.read_token());
         }
     };
 } // namespace statements
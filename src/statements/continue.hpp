@@ -1,6 +1,10 @@
 #pragma once
 
 #include "../control_flow.hpp"
+#include "../bytecode/compiler.hpp"
+#include "../optimizer.hpp"
+#include "../program_image.hpp"
+#include "../resolver.hpp"
 #include "statement.hpp"
 
 namespace statements {
@@ -11,8 +15,27 @@ namespace statements {
     public:
         explicit Continue(Token const& continue_token) : m_continue_token{ continue_token } { }
 
-        void execute(ScopeStack& scope_stack) const override {
-            throw ContinueException{ m_continue_token };
+        [[nodiscard]] Completion execute(ScopeStack& scope_stack) const override {
+            return Completion::continue_(m_continue_token);
+        }
+
+        void compile(bytecode::Compiler& compiler) const override {
+            compiler.emit_continue(m_continue_token);
+        }
+
+        void resolve([[maybe_unused]] Resolver& resolver) override { }
+
+        [[nodiscard]] std::unique_ptr<Statement> optimize([[maybe_unused]] Optimizer& optimizer) override {
+            return nullptr;
+        }
+
+        void serialize(ImageWriter& writer) const override {
+            writer.write_tag(NodeTag::Continue);
+            writer.write_token(m_continue_token);
+        }
+
+        [[nodiscard]] static std::unique_ptr<Statement> deserialize(ImageReader& reader) {
+            return reader.make<Continue>(reader.read_token());
         }
     };
 
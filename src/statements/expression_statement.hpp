@@ -1,5 +1,9 @@
 #pragma once
 
+#include "../bytecode/compiler.hpp"
+#include "../optimizer.hpp"
+#include "../program_image.hpp"
+#include "../resolver.hpp"
 #include "statement.hpp"
 
 namespace statements {
@@ -11,8 +15,32 @@ namespace statements {
         explicit ExpressionStatement(std::unique_ptr<expressions::Expression> expression)
             : m_expression{ std::move(expression) } { }
 
-        void execute(ScopeStack& scope_stack) const override {
+        [[nodiscard]] Completion execute(ScopeStack& scope_stack) const override {
             std::ignore = m_expression->evaluate(scope_stack);
+            return Completion::normal();
+        }
+
+        void compile(bytecode::Compiler& compiler) const override {
+            m_expression->compile(compiler);
+            compiler.emit(bytecode::OpCode::Pop);
+        }
+
+        void resolve(Resolver& resolver) override {
+            m_expression->resolve(resolver);
+        }
+
+        [[nodiscard]] std::unique_ptr<Statement> optimize(Optimizer& optimizer) override {
+            optimizer.optimize(m_expression);
+            return nullptr;
+        }
+
+        void serialize(ImageWriter& writer) const override {
+            writer.write_tag(NodeTag::ExpressionStatement);
+            writer.write_expression(*m_expression);
+        }
+
+        [[nodiscard]] static std::unique_ptr<Statement> deserialize(ImageReader& reader) {
+            return reader.make<ExpressionStatement>(reader.read_expression());
         }
     };
 } // namespace statements
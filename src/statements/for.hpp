@@ -1,8 +1,15 @@
 #pragma once
 
 #include "../control_flow.hpp"
+#include "../values/counted_iteration.hpp"
 #include "../values/iterator.hpp"
+#include "../bytecode/compiler.hpp"
+#include "../optimizer.hpp"
+#include "../program_image.hpp"
+#include "../resolver.hpp"
 #include "statement.hpp"
+#include <concepts>
+#include <optional>
 
 namespace statements {
     class For final : public Statement {
@@ -19,32 +26,106 @@ namespace statements {
               m_iterable{ std::move(iterable) },
               m_body{ std::move(body) } { }
 
-        void execute(ScopeStack& scope_stack) const override {
-            auto const num_scopes = scope_stack.size();
+        [[nodiscard]] Completion execute(ScopeStack& scope_stack) const override {
+            auto const iterable = m_iterable->evaluate(scope_stack);
+            if (values::supports_counted_iteration(iterable)) {
+                return run(scope_stack, [&iterable, index = std::size_t{ 0 }]() mutable {
+                    return values::counted_iteration_element(iterable, index++);
+                });
+            }
 
-            auto const iterator = m_iterable->evaluate(scope_stack)->iterator();
+            auto const iterator = iterable->iterator();
             assert(iterator->is_iterator());
+            return run(scope_stack, [&iterator]() { return iterator->as_iterator().next(); });
+        }
 
-            while (true) {
-                scope_stack.truncate(num_scopes);
-                auto value = iterator->as_iterator().next();
-                if (value->is_sentinel()) {
-                    break;
-                }
-                auto loop_scope = Scope{};
-                if (m_loop_variable.lexeme() != "_") {
-                    loop_scope.insert({ std::string{ m_loop_variable.lexeme() }, std::move(value) });
+        void compile(bytecode::Compiler& compiler) const override {
+            // the iterator (or the iterable and the current index) stays on the operand stack while the loop is running
+            m_iterable->compile(compiler);
+            compiler.emit(bytecode::OpCode::Iterator);
+
+            auto const loop_start = compiler.begin_loop();
+            compiler.emit(bytecode::OpCode::Truncate, static_cast<std::uint32_t>(compiler.scope_depth()));
+            auto const next_instruction = compiler.emit(bytecode::OpCode::IteratorNext);
+            compiler.push_scope();
+            if (m_loop_variable.symbol != symbols::underscore) {
+                compiler.emit(bytecode::OpCode::BindLoopVariable, compiler.add_token(m_loop_variable));
+            } else {
+                compiler.emit(bytecode::OpCode::Pop);
+            }
+            m_body->compile(compiler);
+            compiler.pop_scope();
+            compiler.emit(bytecode::OpCode::Jump, static_cast<std::uint32_t>(loop_start));
+
+            auto const loop_end = compiler.end_loop();
+            compiler.patch_jump(next_instruction, loop_end);
+            compiler.emit(bytecode::OpCode::Pop); // pop the index
+            compiler.emit(bytecode::OpCode::Pop); // pop the iterator
+        }
+
+        void resolve(Resolver& resolver) override {
+            m_iterable->resolve(resolver);
+            resolver.push_scope();
+            if (m_loop_variable.symbol != symbols::underscore) {
+                [[maybe_unused]] auto const definition = resolver.define(m_loop_variable.symbol);
+            }
+            m_body->resolve(resolver);
+            resolver.pop_scope();
+        }
+
+        [[nodiscard]] std::unique_ptr<Statement> optimize(Optimizer& optimizer) override {
+            optimizer.optimize(m_iterable);
+            optimizer.optimize(m_body);
+            return nullptr;
+        }
+
+        void serialize(ImageWriter& writer) const override {
+            writer.write_tag(NodeTag::For);
+            writer.write_token(m_loop_variable);
+            writer.write_expression(*m_iterable);
+            writer.write_statement(*m_body);
+        }
+
+        [[nodiscard]] static std::unique_ptr<Statement> deserialize(ImageReader& reader) {
+            auto const loop_variable = reader.read_token();
+            auto iterable = reader.read_expression();
+            auto body = reader.read_statement();
+            return reader.make<For>(loop_variable, std::move(iterable), std::move(body));
+        }
+
+    private:
+        /* Runs the loop body once for every value returned by `next()` until it returns `std::nullopt`.
+         * The scope of the loop variable is pushed only once and its slot is reused by every iteration. */
+        template<std::invocable Next>
+        [[nodiscard]] Completion run(ScopeStack& scope_stack, Next&& next) const {
+            auto const num_scopes = scope_stack.size();
+            auto const has_loop_variable = (m_loop_variable.symbol != symbols::underscore);
+            scope_stack.push();
+            if (has_loop_variable) {
+                scope_stack.append(m_loop_variable.symbol, values::Value{});
+            }
+
+            while (auto value = next()) {
+                // removes the scopes left behind by the previous iteration
+                scope_stack.truncate(num_scopes + 1);
+                if (has_loop_variable) {
+                    *scope_stack.lookup(Address::local(0, 0), m_loop_variable.symbol) = std::move(*value);
                 }
-                scope_stack.push(std::move(loop_scope));
-                try {
-                    m_body->execute(scope_stack);
-                } catch (BreakException const&) {
-                    break;
-                } catch (ContinueException const&) {
-                    // do nothing -> loop again
+                auto completion = execute_loop_body(scope_stack, [&] { return m_body->execute(scope_stack); });
+                switch (completion.kind()) {
+                    case Completion::Kind::Normal:
+                    case Completion::Kind::Continue:
+                        break;
+                    case Completion::Kind::Break:
+                        scope_stack.truncate(num_scopes);
+                        return Completion::normal();
+                    case Completion::Kind::Return:
+                        scope_stack.truncate(num_scopes);
+                        return completion;
                 }
             }
             scope_stack.truncate(num_scopes);
+            return Completion::normal();
         }
     };
 } // namespace statements
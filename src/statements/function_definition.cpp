@@ -2,18 +2,14 @@
 #include "function_definition.hpp"
 
 namespace statements {
-    void FunctionDefinition::execute(ScopeStack& scope_stack) const {
-        auto name = std::string{ m_name.lexeme() };
-        if (scope_stack.top().contains(name)) {
+    Completion FunctionDefinition::execute(ScopeStack& scope_stack) const {
+        auto const inserted = scope_stack.insert(
+                m_name.symbol,
+                values::Function::make(m_name, m_parameters, m_return_type, m_body.get(), values::ValueCategory::Lvalue)
+        );
+        if (not inserted) {
             throw SymbolRedefinition{ m_name };
         }
-        scope_stack.top().insert({ std::move(name),
-                                   values::Function::make(
-                                           m_name,
-                                           m_parameters,
-                                           m_return_type,
-                                           m_body.get(),
-                                           values::ValueCategory::Lvalue
-                                   ) });
+        return Completion::normal();
     }
 } // namespace statements
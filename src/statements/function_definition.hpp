@@ -1,5 +1,9 @@
 #pragma once
 
+#include "../bytecode/compiler.hpp"
+#include "../optimizer.hpp"
+#include "../program_image.hpp"
+#include "../resolver.hpp"
 #include "statement.hpp"
 
 namespace statements {
@@ -41,6 +45,51 @@ namespace statements {
               m_return_type{ std::move(return_type) },
               m_body{ std::move(body) } { }
 
-        void execute(ScopeStack& scope_stack) const override;
+        [[nodiscard]] Completion execute(ScopeStack& scope_stack) const override;
+
+        void compile(bytecode::Compiler& compiler) const override {
+            compiler.emit(bytecode::OpCode::Execute, compiler.add_statement(*this));
+            compiler.enqueue_function_body(*m_body);
+        }
+
+        void resolve(Resolver& resolver) override {
+            [[maybe_unused]] auto const definition = resolver.define(m_name.symbol);
+            resolver.begin_function();
+            for (auto const& parameter : m_parameters) {
+                [[maybe_unused]] auto const parameter_definition = resolver.define(parameter.name().symbol);
+            }
+            m_body->resolve(resolver);
+            resolver.end_function();
+        }
+
+        [[nodiscard]] std::unique_ptr<Statement> optimize(Optimizer& optimizer) override {
+            optimizer.optimize(m_body);
+            return nullptr;
+        }
+
+        void serialize(ImageWriter& writer) const override {
+            writer.write_tag(NodeTag::FunctionDefinition);
+            writer.write_token(m_name);
+            writer.write_u64(m_parameters.size());
+            for (auto const& parameter : m_parameters) {
+                writer.write_token(parameter.name());
+                writer.write_type(parameter.type());
+            }
+            writer.write_type(m_return_type);
+            writer.write_statement(*m_body);
+        }
+
+        [[nodiscard]] static std::unique_ptr<Statement> deserialize(ImageReader& reader) {
+            auto const name = reader.read_token();
+            auto const num_parameters = reader.read_u64();
+            auto parameters = std::vector<FunctionParameter>{};
+            for (auto i = std::uint64_t{ 0 }; i < num_parameters; ++i) {
+                auto const parameter_name = reader.read_token();
+                parameters.emplace_back(parameter_name, reader.read_type());
+            }
+            auto const return_type = reader.read_type();
+            auto body = reader.read_statement();
+            return reader.make<FunctionDefinition>(name, std::move(parameters), return_type, std::move(body));
+        }
     };
 } // namespace statements
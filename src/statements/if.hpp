@@ -1,6 +1,10 @@
 #pragma once
 
 #include "../values/bool.hpp"
+#include "../bytecode/compiler.hpp"
+#include "../optimizer.hpp"
+#include "../program_image.hpp"
+#include "../resolver.hpp"
 #include "statement.hpp"
 
 namespace statements {
@@ -21,17 +25,67 @@ namespace statements {
               m_then{ std::move(then) },
               m_else{ std::move(else_) } { }
 
-        void execute(ScopeStack& scope_stack) const override {
-            auto const condition = m_condition->evaluate(scope_stack);
+        [[nodiscard]] Completion execute(ScopeStack& scope_stack) const override {
+            auto const condition = m_condition->load(scope_stack);
             if (not condition->is_bool_value()) {
-                throw TypeMismatch{ m_if_token.source_location, std::make_unique<types::Bool>(), condition->type() };
+                throw TypeMismatch{ m_if_token.source_location(), types::make_bool(), condition->type() };
             }
-            auto const evaluated = condition->as_bool_value().value();
+            auto const evaluated = condition->as_bool_value();
             if (evaluated) {
-                m_then->execute(scope_stack);
-            } else {
-                m_else->execute(scope_stack);
+                return m_then->execute(scope_stack);
             }
+            return m_else->execute(scope_stack);
+        }
+
+        void compile(bytecode::Compiler& compiler) const override {
+            m_condition->compile_load(compiler);
+            auto const jump_to_else = compiler.emit(bytecode::OpCode::JumpIfFalse, 0, m_if_token.source_location());
+            m_then->compile(compiler);
+            auto const jump_to_end = compiler.emit(bytecode::OpCode::Jump);
+            compiler.patch_jump(jump_to_else, compiler.current_offset());
+            m_else->compile(compiler);
+            compiler.patch_jump(jump_to_end, compiler.current_offset());
+        }
+
+        void resolve(Resolver& resolver) override {
+            m_condition->resolve(resolver);
+            m_then->resolve(resolver);
+            if (m_else) {
+                m_else->resolve(resolver);
+            }
+        }
+
+        [[nodiscard]] std::unique_ptr<Statement> optimize(Optimizer& optimizer) override {
+            optimizer.optimize(m_condition);
+            optimizer.optimize(m_then);
+            if (m_else) {
+                optimizer.optimize(m_else);
+            }
+            auto const condition = m_condition->constant_value();
+            if (not condition.has_value() or not condition.value()->is_bool_value()) {
+                // non-bool conditions are reported at runtime
+                return nullptr;
+            }
+            if (condition.value()->as_bool_value()) {
+                return std::move(m_then);
+            }
+            return m_else ? std::move(m_else) : optimizer.make_empty_statement();
+        }
+
+        void serialize(ImageWriter& writer) const override {
+            writer.write_tag(NodeTag::If);
+            writer.write_token(m_if_token);
+            writer.write_expression(*m_condition);
+            writer.write_statement(*m_then);
+            writer.write_optional_statement(m_else.get());
+        }
+
+        [[nodiscard]] static std::unique_ptr<Statement> deserialize(ImageReader& reader) {
+            auto const if_token = reader.read_token();
+            auto condition = reader.read_expression();
+            auto then = reader.read_statement();
+            auto else_ = reader.read_optional_statement();
+            return reader.make<If>(if_token, std::move(condition), std::move(then), std::move(else_));
         }
     };
 } // namespace statements
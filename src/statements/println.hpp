@@ -1,5 +1,9 @@
 #pragma once
 
+#include "../bytecode/compiler.hpp"
+#include "../optimizer.hpp"
+#include "../program_image.hpp"
+#include "../resolver.hpp"
 #include "statement.hpp"
 
 namespace statements {
@@ -11,12 +15,44 @@ namespace statements {
         explicit Println(std::unique_ptr<expressions::Expression> expression)
             : m_expression{ std::move(expression) } { }
 
-        void execute(ScopeStack& scope_stack) const override {
+        [[nodiscard]] Completion execute(ScopeStack& scope_stack) const override {
             if (m_expression == nullptr) {
                 std::cout << '\n';
+                return Completion::normal();
+            }
+            std::cout << m_expression->load(scope_stack)->string_representation() << '\n';
+            return Completion::normal();
+        }
+
+        void compile(bytecode::Compiler& compiler) const override {
+            if (m_expression == nullptr) {
+                compiler.emit(bytecode::OpCode::PrintNewline);
                 return;
             }
-            std::cout << m_expression->evaluate(scope_stack)->string_representation() << '\n';
+            m_expression->compile_load(compiler);
+            compiler.emit(bytecode::OpCode::Println);
+        }
+
+        void resolve(Resolver& resolver) override {
+            if (m_expression) {
+                m_expression->resolve(resolver);
+            }
+        }
+
+        [[nodiscard]] std::unique_ptr<Statement> optimize(Optimizer& optimizer) override {
+            if (m_expression) {
+                optimizer.optimize(m_expression);
+            }
+            return nullptr;
+        }
+
+        void serialize(ImageWriter& writer) const override {
+            writer.write_tag(NodeTag::Println);
+            writer.write_optional_expression(m_expression.get());
+        }
+
+        [[nodiscard]] static std::unique_ptr<Statement> deserialize(ImageReader& reader) {
+            return reader.make<Println>(reader.read_optional_expression());
         }
     };
 } // namespace statements
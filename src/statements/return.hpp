@@ -1,6 +1,10 @@
 #pragma once
 
 #include "../control_flow.hpp"
+#include "../bytecode/compiler.hpp"
+#include "../optimizer.hpp"
+#include "../program_image.hpp"
+#include "../resolver.hpp"
 #include "statement.hpp"
 
 namespace statements {
@@ -14,11 +18,50 @@ namespace statements {
             : m_return_token{ return_token },
               m_value{ std::move(value) } { }
 
-        void execute(ScopeStack& scope_stack) const override {
+        [[nodiscard]] Completion execute(ScopeStack& scope_stack) const override {
             if (not m_value.has_value()) {
-                throw ReturnException{ m_return_token };
+                return Completion::return_(m_return_token, std::nullopt);
             }
-            throw ReturnException{ m_return_token, m_value.value()->evaluate(scope_stack) };
+            return Completion::return_(m_return_token, m_value.value()->load(scope_stack));
+        }
+
+        void compile(bytecode::Compiler& compiler) const override {
+            if (m_value.has_value()) {
+                m_value.value()->compile_load(compiler);
+            }
+            if (not compiler.is_inside_function()) {
+                compiler.emit(bytecode::OpCode::ThrowReturn, compiler.add_token(m_return_token));
+                return;
+            }
+            compiler.emit(m_value.has_value() ? bytecode::OpCode::Return : bytecode::OpCode::ReturnNothing);
+        }
+
+        void resolve(Resolver& resolver) override {
+            if (m_value.has_value()) {
+                m_value.value()->resolve(resolver);
+            }
+        }
+
+        [[nodiscard]] std::unique_ptr<Statement> optimize(Optimizer& optimizer) override {
+            if (m_value.has_value()) {
+                optimizer.optimize(m_value.value());
+            }
+            return nullptr;
+        }
+
+        void serialize(ImageWriter& writer) const override {
+            writer.write_tag(NodeTag::Return);
+            writer.write_token(m_return_token);
+            writer.write_optional_expression(m_value.has_value() ? m_value.value().get() : nullptr);
+        }
+
+        [[nodiscard]] static std::unique_ptr<Statement> deserialize(ImageReader& reader) {
+            auto const return_token = reader.read_token();
+            auto value = std::optional<std::unique_ptr<expressions::Expression>>{};
+            if (auto expression = reader.read_optional_expression()) {
+                value = std::move(expression);
+            }
+            return reader.make<Return>(return_token, std::move(value));
         }
     };
 } // namespace statements
@@ -1,18 +1,41 @@
 #pragma once
+#include "../arena.hpp"
+#include "../control_flow.hpp"
 #include "../scope.hpp"
 #include <memory>
 #include <vector>
 
+class Optimizer;
+class Resolver;
+
+class ImageWriter;
+class ImageReader;
+
+namespace bytecode {
+    class Compiler;
+}
+
 namespace statements {
 
-    class Statement {
+    class Statement : public ArenaAllocated {
     protected:
         Statement() = default;
 
     public:
         virtual ~Statement() = default;
 
-        virtual void execute(ScopeStack& scope_stack) const = 0;
+        [[nodiscard]] virtual Completion execute(ScopeStack& scope_stack) const = 0;
+
+        virtual void compile(bytecode::Compiler& compiler) const = 0;
+
+        // annotates all variable references and definitions (see resolver.hpp)
+        virtual void resolve(Resolver& resolver) = 0;
+
+        // optimizes the contained code (see optimizer.hpp), returns a replacement for this statement or nullptr
+        [[nodiscard]] virtual std::unique_ptr<Statement> optimize(Optimizer& optimizer) = 0;
+
+        // writes this statement into a program image (see program_image.hpp)
+        virtual void serialize(ImageWriter& writer) const = 0;
     };
 
     using Statements = std::vector<std::unique_ptr<Statement>>;
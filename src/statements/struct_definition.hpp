@@ -1,6 +1,12 @@
 #pragma once
 
+#include "../bytecode/compiler.hpp"
+#include "../optimizer.hpp"
+#include "../program_image.hpp"
+#include "../resolver.hpp"
 #include "statement.hpp"
+#include <optional>
+#include <string_view>
 
 namespace statements {
     struct StructMember final {
@@ -18,7 +24,40 @@ namespace statements {
             : m_name{ name },
               m_members{ std::move(members) } { }
 
-        void execute(ScopeStack& scope_stack) const override;
+        [[nodiscard]] Completion execute(ScopeStack& scope_stack) const override;
+
+        void compile(bytecode::Compiler& compiler) const override {
+            compiler.emit(bytecode::OpCode::Execute, compiler.add_statement(*this));
+        }
+
+        void resolve(Resolver& resolver) override {
+            [[maybe_unused]] auto const definition = resolver.define(m_name.symbol);
+        }
+
+        [[nodiscard]] std::unique_ptr<Statement> optimize([[maybe_unused]] Optimizer& optimizer) override {
+            return nullptr;
+        }
+
+        void serialize(ImageWriter& writer) const override {
+            writer.write_tag(NodeTag::StructDefinition);
+            writer.write_token(m_name);
+            writer.write_u64(m_members.size());
+            for (auto const& member : m_members) {
+                writer.write_token(member.m_name);
+                writer.write_type(member.m_type);
+            }
+        }
+
+        [[nodiscard]] static std::unique_ptr<Statement> deserialize(ImageReader& reader) {
+            auto const name = reader.read_token();
+            auto const num_members = reader.read_u64();
+            auto members = std::vector<StructMember>{};
+            for (auto i = std::uint64_t{ 0 }; i < num_members; ++i) {
+                auto const member_name = reader.read_token();
+                members.push_back(StructMember{ member_name, reader.read_type() });
+            }
+            return reader.make<StructDefinition>(name, std::move(members));
+        }
 
         [[nodiscard]] std::string to_string() const {
             auto result = std::format("struct {}(", m_name.lexeme());
@@ -38,5 +77,15 @@ namespace statements {
         [[nodiscard]] std::vector<StructMember> const& members() const {
             return m_members;
         }
+
+        // the slot of the member inside of struct values of this type
+        [[nodiscard]] std::optional<std::size_t> member_index(SymbolId const name) const {
+            for (auto i = std::size_t{ 0 }; i < m_members.size(); ++i) {
+                if (m_members[i].m_name.symbol == name) {
+                    return i;
+                }
+            }
+            return std::nullopt;
+        }
     };
 } // namespace statements
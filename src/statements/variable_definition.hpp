@@ -1,5 +1,9 @@
 #pragma once
 
+#include "../bytecode/compiler.hpp"
+#include "../optimizer.hpp"
+#include "../program_image.hpp"
+#include "../resolver.hpp"
 #include "statement.hpp"
 
 namespace statements {
@@ -7,23 +11,59 @@ namespace statements {
     private:
         Token m_name;
         std::unique_ptr<expressions::Expression> m_initializer;
+        Resolver::Definition m_definition{ 0, false };
 
     public:
         VariableDefinition(Token const& name, std::unique_ptr<expressions::Expression> initializer)
             : m_name{ name },
               m_initializer{ std::move(initializer) } { }
 
-        void execute(ScopeStack& scope_stack) const override {
-            if (m_name.lexeme() == "_") {
-                return;
+        [[nodiscard]] Completion execute(ScopeStack& scope_stack) const override {
+            if (m_name.symbol == symbols::underscore) {
+                return Completion::normal();
             }
-            auto value = m_initializer->evaluate(scope_stack)->as_rvalue();
+            auto value = m_initializer->load(scope_stack)->as_rvalue();
             value->promote_to_lvalue();
-            auto const& [iterator, inserted] =
-                    scope_stack.top().insert({ std::string{ m_name.lexeme() }, std::move(value) });
-            if (not inserted) {
+            if (m_definition.is_redefinition) {
                 throw SymbolRedefinition{ m_name };
             }
+            assert(scope_stack.top_size() == m_definition.slot);
+            scope_stack.append(m_name.symbol, std::move(value));
+            return Completion::normal();
+        }
+
+        void compile(bytecode::Compiler& compiler) const override {
+            if (m_name.symbol == symbols::underscore) {
+                return;
+            }
+            m_initializer->compile_load(compiler);
+            compiler.emit(bytecode::OpCode::DefineVariable, compiler.add_token(m_name));
+        }
+
+        void resolve(Resolver& resolver) override {
+            if (m_name.symbol == symbols::underscore) {
+                return;
+            }
+            // the initializer cannot see the variable that is being defined
+            m_initializer->resolve(resolver);
+            m_definition = resolver.define(m_name.symbol);
+        }
+
+        [[nodiscard]] std::unique_ptr<Statement> optimize(Optimizer& optimizer) override {
+            optimizer.optimize(m_initializer);
+            return nullptr;
+        }
+
+        void serialize(ImageWriter& writer) const override {
+            writer.write_tag(NodeTag::VariableDefinition);
+            writer.write_token(m_name);
+            writer.write_expression(*m_initializer);
+        }
+
+        [[nodiscard]] static std::unique_ptr<Statement> deserialize(ImageReader& reader) {
+            auto const name = reader.read_token();
+            auto initializer = reader.read_expression();
+            return reader.make<VariableDefinition>(name, std::move(initializer));
         }
     };
 } // namespace statements
@@ -2,6 +2,10 @@
 
 #include "../control_flow.hpp"
 #include "../values/bool.hpp"
+#include "../bytecode/compiler.hpp"
+#include "../optimizer.hpp"
+#include "../program_image.hpp"
+#include "../resolver.hpp"
 #include "statement.hpp"
 
 namespace statements {
@@ -15,23 +19,65 @@ namespace statements {
             : m_condition{ std::move(condition) },
               m_body{ std::move(body) } { }
 
-        void execute(ScopeStack& scope_stack) const override {
+        [[nodiscard]] Completion execute(ScopeStack& scope_stack) const override {
             while (true) {
-                auto const condition = m_condition->evaluate(scope_stack);
+                auto const condition = m_condition->load(scope_stack);
                 if (not condition->is_bool_value()) {
                     throw TypeMismatch{ m_condition->source_location(), types::make_bool(), condition->type() };
                 }
-                if (not condition->as_bool_value().value()) {
+                if (not condition->as_bool_value()) {
                     break;
                 }
-                try {
-                    m_body->execute(scope_stack);
-                } catch (BreakException const&) {
-                    break;
-                } catch (ContinueException const&) {
-                    // do nothing -> loop once more
+                auto completion = execute_loop_body(scope_stack, [&] { return m_body->execute(scope_stack); });
+                switch (completion.kind()) {
+                    case Completion::Kind::Normal:
+                    case Completion::Kind::Continue:
+                        break;
+                    case Completion::Kind::Break:
+                        return Completion::normal();
+                    case Completion::Kind::Return:
+                        return completion;
                 }
             }
+            return Completion::normal();
+        }
+
+        void compile(bytecode::Compiler& compiler) const override {
+            auto const loop_start = compiler.begin_loop();
+            m_condition->compile_load(compiler);
+            auto const jump_to_end =
+                    compiler.emit(bytecode::OpCode::JumpIfFalse, 0, m_condition->source_location());
+            m_body->compile(compiler);
+            compiler.emit(bytecode::OpCode::Jump, static_cast<std::uint32_t>(loop_start));
+            auto const loop_end = compiler.end_loop();
+            compiler.patch_jump(jump_to_end, loop_end);
+        }
+
+        void resolve(Resolver& resolver) override {
+            m_condition->resolve(resolver);
+            m_body->resolve(resolver);
+        }
+
+        [[nodiscard]] std::unique_ptr<Statement> optimize(Optimizer& optimizer) override {
+            optimizer.optimize(m_condition);
+            optimizer.optimize(m_body);
+            auto const condition = m_condition->constant_value();
+            if (condition.has_value() and condition.value()->is_bool_value() and not condition.value()->as_bool_value()) {
+                return optimizer.make_empty_statement();
+            }
+            return nullptr;
+        }
+
+        void serialize(ImageWriter& writer) const override {
+            writer.write_tag(NodeTag::While);
+            writer.write_expression(*m_condition);
+            writer.write_statement(*m_body);
+        }
+
+        [[nodiscard]] static std::unique_ptr<Statement> deserialize(ImageReader& reader) {
+            auto condition = reader.read_expression();
+            auto body = reader.read_statement();
+            return reader.make<While>(std::move(condition), std::move(body));
         }
     };
 } // namespace statements
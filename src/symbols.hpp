@@ -0,0 +1,89 @@
+#pragma once
+
+#include "builtin_function_type.hpp"
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// two names are equal if and only if their symbols are equal
+using SymbolId = std::uint32_t;
+
+namespace symbols {
+    // the builtin functions get the first symbols (in the order of `builtin_function_types`)
+    [[nodiscard]] constexpr SymbolId builtin_function(BuiltinFunctionType const type) {
+        for (auto i = std::size_t{ 0 }; i < builtin_function_types.size(); ++i) {
+            if (builtin_function_types[i] == type) {
+                return static_cast<SymbolId>(i);
+            }
+        }
+        assert(false and "unreachable");
+        return 0;
+    }
+
+    // names with a special meaning that are interned after the builtin functions
+    inline constexpr auto underscore = static_cast<SymbolId>(builtin_function_types.size());
+    inline constexpr auto size = underscore + 1;
+    inline constexpr auto length = underscore + 2;
+
+    // contextual keywords: they are only special in certain places, elsewhere they are ordinary names
+    inline constexpr auto contextual_keywords =
+            std::to_array<std::string_view>({ "else", "in", "print", "println", "assert", "break", "continue", "return" });
+    inline constexpr auto else_ = underscore + 3;
+    inline constexpr auto in = underscore + 4;
+    inline constexpr auto print = underscore + 5;
+    inline constexpr auto println = underscore + 6;
+    inline constexpr auto assert_ = underscore + 7;
+    inline constexpr auto break_ = underscore + 8;
+    inline constexpr auto continue_ = underscore + 9;
+    inline constexpr auto return_ = underscore + 10;
+
+    // the symbol of all tokens that are no identifiers
+    inline constexpr auto none = std::numeric_limits<SymbolId>::max();
+} // namespace symbols
+
+/* The lexer interns every identifier of a program, so that all later stages only compare
+ * symbols instead of strings. The names are views into the source code (or into other storage
+ * that outlives the table). */
+class SymbolTable final {
+private:
+    std::vector<std::string_view> m_names;
+    std::unordered_map<std::string_view, SymbolId> m_symbols;
+
+public:
+    SymbolTable() {
+        for (auto const type : builtin_function_types) {
+            [[maybe_unused]] auto const symbol = intern(to_view(type));
+            assert(symbol == symbols::builtin_function(type));
+        }
+        [[maybe_unused]] auto const underscore = intern("_");
+        [[maybe_unused]] auto const size = intern("size");
+        [[maybe_unused]] auto const length = intern("length");
+        assert(underscore == symbols::underscore and size == symbols::size and length == symbols::length);
+        for (auto const keyword : symbols::contextual_keywords) {
+            [[maybe_unused]] auto const symbol = intern(keyword);
+        }
+        assert(intern("else") == symbols::else_ and intern("return") == symbols::return_);
+    }
+
+    // returns the symbol of the given name, which gets added if it is not part of the table yet
+    [[nodiscard]] SymbolId intern(std::string_view const name) {
+        auto const [iterator, inserted] = m_symbols.try_emplace(name, static_cast<SymbolId>(m_names.size()));
+        if (inserted) {
+            m_names.push_back(name);
+        }
+        return iterator->second;
+    }
+
+    [[nodiscard]] std::string_view name(SymbolId const symbol) const {
+        return m_names.at(symbol);
+    }
+
+    [[nodiscard]] std::size_t size() const {
+        return m_names.size();
+    }
+};
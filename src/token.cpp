@@ -1,14 +1,42 @@
 #include "token.hpp"
 #include "runtime_error.hpp"
+#include <charconv>
 
 [[nodiscard]] std::int32_t Token::parse_integer() const {
     assert(type == TokenType::IntegerLiteral);
-    auto stream = std::stringstream{};
-    stream << lexeme();
+    auto const text = lexeme();
     auto result = std::int32_t{};
-    stream >> result;
-    if (not stream) {
-        throw InvalidIntegerValue{ lexeme() };
+    auto const [end, error] = std::from_chars(text.data(), text.data() + text.length(), result);
+    if (error != std::errc{} or end != text.data() + text.length()) {
+        throw InvalidIntegerValue{ text };
     }
     return result;
 }
+
+[[nodiscard]] std::uint8_t Token::parse_char() const {
+    assert(type == TokenType::CharLiteral);
+    auto const text = lexeme();
+    // the lexer only accepts valid escape sequences
+    auto const is_escape_sequence = (text.length() == 4);
+    assert(is_escape_sequence or text.length() == 3);
+    if (not is_escape_sequence) {
+        return static_cast<std::uint8_t>(text[1]);
+    }
+    switch (text[2]) {
+        case 'n':
+            return '\n';
+        case 'r':
+            return '\r';
+        case 't':
+            return '\t';
+        case 'v':
+            return '\v';
+        case '\\':
+            return '\\';
+        case '\'':
+            return '\'';
+        default:
+            assert(false and "unreachable");
+            return '\0';
+    }
+}
@@ -1,11 +1,14 @@
 #pragma once
 
 #include "source_location.hpp"
+#include "source_table.hpp"
+#include "symbols.hpp"
 #include <cassert>
+#include <cstdint>
 #include <iostream>
 #include <string_view>
 
-enum class TokenType {
+enum class TokenType : std::uint8_t {
     LeftParenthesis,
     RightParenthesis,
     Semicolon,
@@ -40,23 +43,56 @@ enum class TokenType {
     Colon,
     TildeArrow,
     QuestionMark,
+    // keywords (see keywords.hpp)
+    And,
+    False,
+    For,
+    Function,
+    If,
+    Let,
+    Mod,
+    New,
+    Or,
+    Struct,
+    True,
+    TypeOf,
+    While,
     EndOfInput,
 };
 
+// tokens only refer to their lexeme by its global offset (see source_table.hpp) to stay small
 struct Token final {
-    TokenType type;
-    SourceLocation source_location;
+    static constexpr auto max_length = (std::uint32_t{ 1 } << 24) - 1;
 
-    Token(TokenType const type, SourceLocation const& source_location)
-        : type{ type },
-          source_location{ source_location } { }
+    std::uint32_t offset;
+    std::uint32_t length : 24;
+    TokenType type : 8;
+    SymbolId symbol; // the interned lexeme of identifiers (see symbols.hpp)
+
+    Token(TokenType const type,
+          std::uint32_t const offset,
+          std::uint32_t const length,
+          SymbolId const symbol = symbols::none)
+        : offset{ offset },
+          length{ length },
+          type{ type },
+          symbol{ symbol } {
+        assert(length <= max_length);
+    }
+
+    [[nodiscard]] SourceLocation source_location() const {
+        return SourceTable::instance().location(offset, length);
+    }
 
     [[nodiscard]] std::string_view lexeme() const {
-        return source_location.text();
+        return SourceTable::instance().text(offset, length);
     }
 
     [[nodiscard]] std::int32_t parse_integer() const;
 
+    // decodes the (possibly escaped) character of a char literal
+    [[nodiscard]] std::uint8_t parse_char() const;
+
     friend std::ostream& operator<<(std::ostream& os, Token const& token) {
         switch (token.type) {
             default:
@@ -130,9 +166,25 @@ struct Token final {
                 return os << "SlashEquals";
             case TokenType::QuestionMark:
                 return os << "QuestionMark";
+            case TokenType::And:
+            case TokenType::False:
+            case TokenType::For:
+            case TokenType::Function:
+            case TokenType::If:
+            case TokenType::Let:
+            case TokenType::Mod:
+            case TokenType::New:
+            case TokenType::Or:
+            case TokenType::Struct:
+            case TokenType::True:
+            case TokenType::TypeOf:
+            case TokenType::While:
+                return os << "Keyword(" << token.lexeme() << ')';
         }
     }
 };
 
+static_assert(sizeof(Token) == 12);
+
 template<>
 struct std::formatter<Token> : ostream_formatter { };
@@ -1,13 +1,48 @@
 #include "types.hpp"
 #include "statements/struct_definition.hpp"
+#include <map>
+#include <utility>
 
-[[nodiscard]] std::string types::StructType::to_string() const {
-    return m_definition->to_string();
-}
+namespace types {
+    namespace {
+        // looks up the canonical descriptor for `key`, creating it on first use
+        template<typename T, typename Key, typename... Args>
+        [[nodiscard]] Type intern(std::map<Key, std::unique_ptr<T const>>& table, Key const& key, Args&&... args) {
+            auto& entry = table[key];
+            if (entry == nullptr) {
+                entry = std::make_unique<T const>(std::forward<Args>(args)...);
+            }
+            return entry.get();
+        }
+    } // namespace
 
-[[nodiscard]] bool types::StructType::equals(BasicType const& other) const {
-    if (auto const other_struct = dynamic_cast<StructType const*>(&other)) {
-        return m_definition == other_struct->m_definition;
+    [[nodiscard]] std::string StructType::to_string() const {
+        return m_definition->to_string();
     }
-    return false;
-}
+
+    [[nodiscard]] Type make_array(Type const contained_type) {
+        static auto table = std::map<Type, std::unique_ptr<Array const>>{};
+        return intern(table, contained_type, contained_type);
+    }
+
+    [[nodiscard]] Type make_array_iterator(Type const array_type) {
+        static auto table = std::map<Type, std::unique_ptr<ArrayIterator const>>{};
+        return intern(table, array_type, array_type);
+    }
+
+    [[nodiscard]] Type make_function(std::vector<Type> const& parameter_types, Type const return_type) {
+        using Signature = std::pair<std::vector<Type>, Type>;
+        static auto table = std::map<Signature, std::unique_ptr<Function const>>{};
+        return intern(table, Signature{ parameter_types, return_type }, parameter_types, return_type);
+    }
+
+    [[nodiscard]] Type make_builtin_function(BuiltinFunctionType const type) {
+        static auto table = std::map<BuiltinFunctionType, std::unique_ptr<BuiltinFunction const>>{};
+        return intern(table, type, type);
+    }
+
+    [[nodiscard]] Type make_struct_type(statements::StructDefinition const* const definition) {
+        static auto table = std::map<statements::StructDefinition const*, std::unique_ptr<StructType const>>{};
+        return intern(table, definition, definition);
+    }
+} // namespace types
@@ -2,7 +2,9 @@
 
 #include "builtin_function_type.hpp"
 #include "source_location.hpp"
+#include <cstdint>
 #include <format>
+#include <stdexcept>
 #include <memory>
 #include <string>
 #include <vector>
@@ -14,82 +16,101 @@ namespace statements {
 namespace types {
     class BasicType;
 
-    using Type = std::shared_ptr<BasicType>;
+    /* Types are interned: for every type there is exactly one (immutable) descriptor that lives
+     * until the end of the program, so two types are equal if and only if they are the same
+     * pointer. Descriptors are only handed out by the `make_*()` functions below. */
+    using Type = BasicType const*;
 
     class Array;
     class Function;
 
+    enum class Kind : std::uint8_t {
+        I32,
+        Char,
+        Bool,
+        String,
+        Array,
+        RangeIterator,
+        Range,
+        ArrayIterator,
+        StringIterator,
+        Unspecified,
+        Nothing,
+        BuiltinFunction,
+        Function,
+        StructType,
+    };
+
     class BasicType {
+    private:
+        Kind m_kind;
+
+    protected:
+        explicit BasicType(Kind const kind) : m_kind{ kind } { }
+
     public:
+        BasicType(BasicType const&) = delete;
+        BasicType& operator=(BasicType const&) = delete;
+
         virtual ~BasicType() = default;
 
-        [[nodiscard]] virtual std::string to_string() const = 0;
+        [[nodiscard]] Kind kind() const {
+            return m_kind;
+        }
 
-        [[nodiscard]] virtual bool equals(BasicType const& other) const = 0;
+        [[nodiscard]] virtual std::string to_string() const = 0;
 
-        [[nodiscard]] virtual bool can_be_created_from(Type const& other) const {
-            return this->equals(*other);
+        [[nodiscard]] virtual bool can_be_created_from(Type const other) const {
+            return this == other;
         }
 
-        [[nodiscard]] virtual bool is_array() const {
-            return false;
+        [[nodiscard]] bool is_array() const {
+            return m_kind == Kind::Array;
         }
 
-        [[nodiscard]] virtual Array const& as_array() const {
-            throw std::runtime_error{ "unreachable" };
-        }
+        [[nodiscard]] Array const& as_array() const;
 
-        [[nodiscard]] virtual bool is_function() const {
-            return false;
+        [[nodiscard]] bool is_function() const {
+            return m_kind == Kind::Function;
         }
 
-        [[nodiscard]] virtual Function const& as_function() const {
-            throw std::runtime_error{ "unreachable" };
-        }
+        [[nodiscard]] Function const& as_function() const;
     };
 
     class I32 final : public BasicType {
     public:
+        I32() : BasicType{ Kind::I32 } { }
+
         [[nodiscard]] std::string to_string() const override {
             return "I32";
         }
-
-        [[nodiscard]] bool equals(BasicType const& other) const override {
-            return dynamic_cast<I32 const*>(&other) != nullptr;
-        }
     };
 
     class Char final : public BasicType {
     public:
+        Char() : BasicType{ Kind::Char } { }
+
         [[nodiscard]] std::string to_string() const override {
             return "Char";
         }
-
-        [[nodiscard]] bool equals(BasicType const& other) const override {
-            return dynamic_cast<Char const*>(&other) != nullptr;
-        }
     };
 
     class Bool final : public BasicType {
     public:
+        Bool() : BasicType{ Kind::Bool } { }
+
         [[nodiscard]] std::string to_string() const override {
             return "Bool";
         }
-
-        [[nodiscard]] bool equals(BasicType const& other) const override {
-            return dynamic_cast<Bool const*>(&other) != nullptr;
-        }
     };
 
     class String final : public BasicType {
     public:
+        String() : BasicType{ Kind::String } { }
+
         [[nodiscard]] std::string to_string() const override {
             return "String";
         }
-
-        [[nodiscard]] bool equals(BasicType const& other) const override {
-            return dynamic_cast<String const*>(&other) != nullptr;
-        }
     };
 
     class Array final : public BasicType {
@@ -97,64 +118,38 @@ namespace types {
         Type m_contained_type;
 
     public:
-        explicit Array(Type contained_type) : m_contained_type{ std::move(contained_type) } { }
+        explicit Array(Type const contained_type) : BasicType{ Kind::Array }, m_contained_type{ contained_type } { }
 
-        [[nodiscard]] std::string to_string() const override {
-            return std::format("[{}]", m_contained_type->to_string());
+        [[nodiscard]] Type contained_type() const {
+            return m_contained_type;
         }
 
-        [[nodiscard]] bool equals(BasicType const& other) const override {
-            if (auto const other_array = dynamic_cast<Array const*>(&other); other_array != nullptr) {
-                return m_contained_type->equals(*other_array->m_contained_type);
-            }
-            return false;
+        [[nodiscard]] std::string to_string() const override {
+            return std::format("[{}]", m_contained_type->to_string());
         }
 
-        [[nodiscard]] bool can_be_created_from(Type const& other) const override {
+        [[nodiscard]] bool can_be_created_from(Type const other) const override {
             return BasicType::can_be_created_from(other)
                    or (other->is_array() and m_contained_type->can_be_created_from(other->as_array().m_contained_type));
         }
-
-        [[nodiscard]] bool is_array() const override {
-            return true;
-        }
-
-        [[nodiscard]] Array const& as_array() const override {
-            return *this;
-        }
-    };
-
-    class Sentinel final : public BasicType {
-    public:
-        [[nodiscard]] std::string to_string() const override {
-            return "Sentinel";
-        }
-
-        [[nodiscard]] bool equals(BasicType const& other) const override {
-            return dynamic_cast<Sentinel const*>(&other) != nullptr;
-        }
     };
 
     class RangeIterator final : public BasicType {
     public:
+        RangeIterator() : BasicType{ Kind::RangeIterator } { }
+
         [[nodiscard]] std::string to_string() const override {
             return "RangeIterator";
         }
-
-        [[nodiscard]] bool equals(BasicType const& other) const override {
-            return dynamic_cast<RangeIterator const*>(&other) != nullptr;
-        }
     };
 
     class Range final : public BasicType {
     public:
+        Range() : BasicType{ Kind::Range } { }
+
         [[nodiscard]] std::string to_string() const override {
             return "Range";
         }
-
-        [[nodiscard]] bool equals(BasicType const& other) const override {
-            return dynamic_cast<Range const*>(&other) != nullptr;
-        }
     };
 
     class ArrayIterator final : public BasicType {
@@ -162,55 +157,42 @@ namespace types {
         Type m_array_type;
 
     public:
-        explicit ArrayIterator(Type array_type) : m_array_type{ std::move(array_type) } { }
+        explicit ArrayIterator(Type const array_type) : BasicType{ Kind::ArrayIterator }, m_array_type{ array_type } { }
 
         [[nodiscard]] std::string to_string() const override {
             return std::format("ArrayIterator({})", m_array_type->to_string());
         }
-
-        [[nodiscard]] bool equals(BasicType const& other) const override {
-            if (auto const other_iterator = dynamic_cast<ArrayIterator const*>(&other); other_iterator != nullptr) {
-                return m_array_type->equals(*other_iterator->m_array_type);
-            }
-            return false;
-        }
     };
 
     class StringIterator final : public BasicType {
     public:
+        StringIterator() : BasicType{ Kind::StringIterator } { }
+
         [[nodiscard]] std::string to_string() const override {
             return "StringIterator";
         }
-
-        [[nodiscard]] bool equals(BasicType const& other) const override {
-            return dynamic_cast<StringIterator const*>(&other) != nullptr;
-        }
     };
 
     class Unspecified final : public BasicType {
     public:
+        Unspecified() : BasicType{ Kind::Unspecified } { }
+
         [[nodiscard]] std::string to_string() const override {
             return "?";
         }
 
-        [[nodiscard]] bool equals(BasicType const& other) const override {
-            return dynamic_cast<Unspecified const*>(&other) != nullptr;
-        }
-
-        [[nodiscard]] bool can_be_created_from(Type const& other) const override {
+        [[nodiscard]] bool can_be_created_from(Type const other) const override {
             return true; // we can convert anything to "?"
         }
     };
 
     class Nothing final : public BasicType {
     public:
+        Nothing() : BasicType{ Kind::Nothing } { }
+
         [[nodiscard]] std::string to_string() const override {
             return "Nothing";
         }
-
-        [[nodiscard]] bool equals(BasicType const& other) const override {
-            return dynamic_cast<Nothing const*>(&other) != nullptr;
-        }
     };
 
     class BuiltinFunction final : public BasicType {
@@ -218,14 +200,15 @@ namespace types {
         BuiltinFunctionType m_type;
 
     public:
-        explicit BuiltinFunction(BuiltinFunctionType const type) : m_type{ type } { }
+        explicit BuiltinFunction(BuiltinFunctionType const type) : BasicType{ Kind::BuiltinFunction }, m_type{ type } { }
 
         [[nodiscard]] std::string to_string() const override {
             return std::format("BuiltinFunction({})", to_view(m_type));
         }
 
-        [[nodiscard]] bool equals(BasicType const& other) const override {
-            return dynamic_cast<BuiltinFunction const*>(&other) != nullptr;
+        [[nodiscard]] bool can_be_created_from(Type const other) const override {
+            // all builtin functions are interchangeable
+            return other->kind() == Kind::BuiltinFunction;
         }
     };
 
@@ -235,9 +218,18 @@ namespace types {
         Type m_return_type;
 
     public:
-        Function(std::vector<Type> parameter_types, Type return_type)
-            : m_parameter_types{ std::move(parameter_types) },
-              m_return_type{ std::move(return_type) } { }
+        Function(std::vector<Type> parameter_types, Type const return_type)
+            : BasicType{ Kind::Function },
+              m_parameter_types{ std::move(parameter_types) },
+              m_return_type{ return_type } { }
+
+        [[nodiscard]] std::vector<Type> const& parameter_types() const {
+            return m_parameter_types;
+        }
+
+        [[nodiscard]] Type return_type() const {
+            return m_return_type;
+        }
 
         [[nodiscard]] std::string to_string() const override {
             auto parameters = std::string{};
@@ -250,30 +242,10 @@ namespace types {
             return std::format("Function({}) ~> {}", parameters, m_return_type->to_string());
         }
 
-        [[nodiscard]] bool equals(BasicType const& other) const override {
-            if (not other.is_function()) {
-                return false;
-            }
-            if (m_parameter_types.size() != other.as_function().m_parameter_types.size()) {
-                return false;
+        [[nodiscard]] bool can_be_created_from(Type const other) const override {
+            if (this == other) {
+                return true;
             }
-            for (auto i = std::size_t{ 0 }; i < m_parameter_types.size(); ++i) {
-                if (not m_parameter_types.at(i)->equals(*other.as_function().m_parameter_types.at(i))) {
-                    return false;
-                }
-            }
-            return m_return_type->equals(*other.as_function().m_return_type);
-        }
-
-        [[nodiscard]] bool is_function() const override {
-            return true;
-        }
-
-        [[nodiscard]] Function const& as_function() const override {
-            return *this;
-        }
-
-        [[nodiscard]] bool can_be_created_from(Type const& other) const override {
             if (not other->is_function()) {
                 return false;
             }
@@ -298,74 +270,79 @@ namespace types {
         statements::StructDefinition const* m_definition;
 
     public:
-        explicit StructType(statements::StructDefinition const* const definition) : m_definition{ definition } { }
+        explicit StructType(statements::StructDefinition const* const definition)
+            : BasicType{ Kind::StructType },
+              m_definition{ definition } { }
 
         [[nodiscard]] std::string to_string() const override;
-
-        [[nodiscard]] bool equals(BasicType const& other) const override;
     };
 
-    [[nodiscard]] inline bool operator==(Type const& lhs, Type const& rhs) {
-        return lhs->equals(*rhs);
+    [[nodiscard]] inline Array const& BasicType::as_array() const {
+        if (not is_array()) {
+            throw std::runtime_error{ "unreachable" };
+        }
+        return static_cast<Array const&>(*this);
+    }
+
+    [[nodiscard]] inline Function const& BasicType::as_function() const {
+        if (not is_function()) {
+            throw std::runtime_error{ "unreachable" };
+        }
+        return static_cast<Function const&>(*this);
     }
 
     [[nodiscard]] inline Type make_bool() {
-        return std::make_shared<Bool>();
+        static auto const type = Bool{};
+        return &type;
     }
 
     [[nodiscard]] inline Type make_i32() {
-        return std::make_shared<I32>();
+        static auto const type = I32{};
+        return &type;
     }
 
     [[nodiscard]] inline Type make_char() {
-        return std::make_shared<Char>();
+        static auto const type = Char{};
+        return &type;
     }
 
     [[nodiscard]] inline Type make_string() {
-        return std::make_shared<String>();
+        static auto const type = String{};
+        return &type;
     }
 
-    [[nodiscard]] inline Type make_sentinel() {
-        return std::make_shared<Sentinel>();
-    }
+    [[nodiscard]] Type make_array(Type contained_type);
 
-    [[nodiscard]] inline Type make_array(Type contained_type) {
-        return std::make_shared<Array>(std::move(contained_type));
-    }
-
-    [[nodiscard]] inline Type make_array_iterator(Type array_type) {
-        return std::make_shared<ArrayIterator>(std::move(array_type));
-    }
+    [[nodiscard]] Type make_array_iterator(Type array_type);
 
     [[nodiscard]] inline Type make_string_iterator() {
-        return std::make_shared<StringIterator>();
+        static auto const type = StringIterator{};
+        return &type;
     }
 
     [[nodiscard]] inline Type make_range() {
-        return std::make_shared<Range>();
+        static auto const type = Range{};
+        return &type;
     }
 
     [[nodiscard]] inline Type make_range_iterator() {
-        return std::make_shared<RangeIterator>();
+        static auto const type = RangeIterator{};
+        return &type;
     }
 
-    [[nodiscard]] inline Type make_function(std::vector<Type> parameter_types, Type return_type) {
-        return std::make_shared<Function>(std::move(parameter_types), std::move(return_type));
-    }
+    [[nodiscard]] Type make_function(std::vector<Type> const& parameter_types, Type return_type);
 
     [[nodiscard]] inline Type make_nothing() {
-        return std::make_shared<Nothing>();
+        static auto const type = Nothing{};
+        return &type;
     }
 
     [[nodiscard]] inline Type make_unspecified() {
-        return std::make_shared<Unspecified>();
+        static auto const type = Unspecified{};
+        return &type;
     }
 
-    [[nodiscard]] inline Type make_builtin_function(BuiltinFunctionType const type) {
-        return std::make_shared<BuiltinFunction>(type);
-    }
+    [[nodiscard]] Type make_builtin_function(BuiltinFunctionType type);
 
-    [[nodiscard]] inline Type make_struct_type(statements::StructDefinition const* const definition) {
-        return std::make_shared<StructType>(definition);
-    }
+    [[nodiscard]] Type make_struct_type(statements::StructDefinition const* definition);
 } // namespace types
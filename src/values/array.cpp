@@ -1,32 +1,280 @@
 #include "array.hpp"
+#include "../overloaded.hpp"
 #include "array_iterator.hpp"
+#include "element_reference.hpp"
 
 namespace values {
 
+    [[nodiscard]] Value Array::make(std::vector<Value> elements, ValueCategory const value_category) {
+        auto const element_type = elements.empty() ? types::make_unspecified() : elements.front()->type();
+        for ([[maybe_unused]] auto const& element : elements) {
+            assert(element->type() == element_type);
+        }
+
+        if (element_type == types::make_i32()) {
+            auto integers = Integers{};
+            integers.reserve(elements.size());
+            for (auto const& element : elements) {
+                integers.push_back(element->as_integer_value());
+            }
+            return make_pooled<Array>(std::move(integers), value_category);
+        }
+        if (element_type == types::make_char()) {
+            auto chars = Chars{};
+            chars.reserve(elements.size());
+            for (auto const& element : elements) {
+                chars.push_back(element->as_char_value());
+            }
+            return make_pooled<Array>(std::move(chars), value_category);
+        }
+        if (element_type == types::make_bool()) {
+            auto bools = Bools{};
+            bools.reserve(elements.size());
+            for (auto const& element : elements) {
+                bools.push_back(element->as_bool_value());
+            }
+            return make_pooled<Array>(std::move(bools), value_category);
+        }
+
+        // arrays always contain lvalues
+        for (auto& element : elements) {
+            if (element->is_lvalue()) {
+                element = element->clone();
+            } else {
+                element->promote_to_lvalue();
+            }
+        }
+        return make_pooled<Array>(std::move(elements), value_category);
+    }
+
+    [[nodiscard]] Value Array::at(std::size_t const index) const {
+        assert(index < size());
+        if (std::holds_alternative<Boxed>(*m_storage)) {
+            auto& elements = std::get<Boxed>(unique_storage());
+            m_is_shareable = false;
+            return elements[index];
+        }
+        // `Array` values are always shared, and the element reference is allowed to modify the array
+        return ElementReference::make(std::const_pointer_cast<Array>(shared_from_this()), index);
+    }
+
+    [[nodiscard]] Value Array::load(std::size_t const index) const {
+        assert(index < size());
+        return std::visit(
+                overloaded{
+                        [&](Boxed const& elements) { return elements[index]->as_rvalue(); },
+                        [&](Integers const& elements) { return Integer::make(elements[index], ValueCategory::Rvalue); },
+                        [&](Chars const& elements) { return Char::make(elements[index], ValueCategory::Rvalue); },
+                        [&](Bools const& elements) { return Bool::make(elements[index], ValueCategory::Rvalue); },
+                },
+                *m_storage
+        );
+    }
+
+    void Array::store(std::size_t const index, Value const& value) {
+        assert(index < size());
+        std::visit(
+                overloaded{
+                        [&](Boxed& elements) { elements[index]->assign(value); },
+                        [&](Integers& elements) { elements[index] = value->as_integer_value(); },
+                        [&](Chars& elements) { elements[index] = value->as_char_value(); },
+                        [&](Bools& elements) { elements[index] = value->as_bool_value(); },
+                },
+                unique_storage()
+        );
+    }
+
+    void Array::erase(std::size_t const index) {
+        assert(index < size());
+        std::visit(
+                [&](auto& elements) {
+                    using Difference = std::iterator_traits<decltype(elements.begin())>::difference_type;
+                    elements.erase(std::next(elements.begin(), static_cast<Difference>(index)));
+                },
+                unique_storage()
+        );
+        ++m_generation;
+    }
+
+    void Array::push(Value const& value) {
+        if (size() == 0) {
+            // the kind of storage depends on the element type
+            assign(make({ value }, ValueCategory::Rvalue));
+            return;
+        }
+        if (types::make_array(value->type()) != type()) {
+            throw WrongArgumentType{ "push", "value", value->type() };
+        }
+        std::visit(
+                overloaded{
+                        [&](Boxed& elements) {
+                            elements.push_back(value->is_lvalue() ? value->clone() : value);
+                            elements.back()->promote_to_lvalue();
+                        },
+                        [&](Integers& elements) { elements.push_back(value->as_integer_value()); },
+                        [&](Chars& elements) { elements.push_back(value->as_char_value()); },
+                        [&](Bools& elements) { elements.push_back(value->as_bool_value()); },
+                },
+                unique_storage()
+        );
+    }
+
+    [[nodiscard]] Value Array::pop() {
+        if (size() == 0) {
+            throw PopFromEmptyArray{};
+        }
+        auto result = load(size() - 1);
+        std::visit([](auto& elements) { elements.pop_back(); }, unique_storage());
+        ++m_generation;
+        return result;
+    }
+
+    void Array::reserve(std::size_t const capacity) {
+        std::visit([&](auto& elements) { elements.reserve(capacity); }, unique_storage());
+    }
+
+    [[nodiscard]] std::size_t Array::capacity() const {
+        return std::visit([](auto const& elements) { return elements.capacity(); }, *m_storage);
+    }
+
+    [[nodiscard]] types::Type Array::type() const {
+        return std::visit(
+                overloaded{
+                        [](Boxed const& elements) {
+                            if (elements.empty()) {
+                                return types::make_array(types::make_unspecified());
+                            }
+                            return types::make_array(elements.front()->type());
+                        },
+                        [](Integers const& elements) {
+                            return types::make_array(elements.empty() ? types::make_unspecified() : types::make_i32());
+                        },
+                        [](Chars const& elements) {
+                            return types::make_array(elements.empty() ? types::make_unspecified() : types::make_char());
+                        },
+                        [](Bools const& elements) {
+                            return types::make_array(elements.empty() ? types::make_unspecified() : types::make_bool());
+                        },
+                },
+                *m_storage
+        );
+    }
+
+    [[nodiscard]] Value Array::binary_plus(Value const& other) const {
+        if (size() == 0) {
+            return other->as_rvalue();
+        }
+
+        if (other->as_array().size() == 0) {
+            return as_rvalue();
+        }
+
+        if (type() != other->type()) {
+            return BasicValue::binary_plus(other); // throws
+        }
+
+        // both arrays have the same (non-empty) element type, so they also use the same kind of storage
+        auto storage = copy_storage();
+        std::visit(
+                [&](auto& elements) {
+                    using Elements = std::remove_cvref_t<decltype(elements)>;
+                    auto other_storage = other->as_array().copy_storage();
+                    auto& other_elements = std::get<Elements>(other_storage);
+                    elements.insert(
+                            elements.end(),
+                            std::make_move_iterator(other_elements.begin()),
+                            std::make_move_iterator(other_elements.end())
+                    );
+                },
+                storage
+        );
+
+        /* The resulting array itself is an rvalue (containing lvalues), so assigning to a
+         * temporary array (e.g. array literal) is possible, but has no effect.
+         * But this has the benefit of not having to recursively promote all values of an
+         * array to lvalues when the value itself becomes an lvalue (e.g. when being assigned
+         * to a variable. */
+        return make_pooled<Array>(std::move(storage), ValueCategory::Rvalue);
+    }
+
+    void Array::add_assign(Value const& other) {
+        if (not other->is_array() or size() == 0 or type() != other->type()) {
+            assign(binary_plus(other)); // throws if the types don't match
+            return;
+        }
+        auto const& other_array = other->as_array();
+
+        // copy first, since `other` might refer to this array
+        auto other_storage = other_array.copy_storage();
+        std::visit(
+                [&](auto& elements) {
+                    using Elements = std::remove_cvref_t<decltype(elements)>;
+                    auto& other_elements = std::get<Elements>(other_storage);
+                    elements.insert(
+                            elements.end(),
+                            std::make_move_iterator(other_elements.begin()),
+                            std::make_move_iterator(other_elements.end())
+                    );
+                },
+                unique_storage()
+        );
+    }
+
     [[nodiscard]] Value Array::iterator() {
         return ArrayIterator::make(shared_from_this(), ValueCategory::Rvalue);
     }
 
     [[nodiscard]] Value Array::member_access(Token member) const {
-        if (member.type != TokenType::Identifier or member.lexeme() != "size") {
+        if (member.type != TokenType::Identifier or member.symbol != symbols::size) {
             return BasicValue::member_access(member); // throws
         }
-        return Integer::make(static_cast<Integer::ValueType>(m_elements.size()), ValueCategory::Rvalue);
+        return Integer::make(static_cast<Integer::ValueType>(size()), ValueCategory::Rvalue);
     }
 
     [[nodiscard]] Value Array::equals(Value const& other) const {
         if (type() != other->type()) {
             return BasicValue::equals(other); // throws
         }
-        if (m_elements.size() != other->as_array().m_elements.size()) {
+        auto const& other_array = other->as_array();
+        if (size() != other_array.size()) {
             return Bool::make(false, ValueCategory::Rvalue);
         }
-        for (auto i = std::size_t{ 0 }; i < m_elements.size(); ++i) {
-            if (not m_elements.at(i)->equals(other->as_array().m_elements.at(i))) {
-                return Bool::make(false, ValueCategory::Rvalue);
+        if (size() == 0) {
+            // empty arrays may differ in their kind of storage
+            return Bool::make(true, ValueCategory::Rvalue);
+        }
+        auto const elements_equal = std::visit(
+                overloaded{
+                        [&](Boxed const& elements) {
+                            auto const& other_elements = std::get<Boxed>(*other_array.m_storage);
+                            for (auto i = std::size_t{ 0 }; i < elements.size(); ++i) {
+                                if (not elements[i]->equals(other_elements[i])->as_bool_value()) {
+                                    return false;
+                                }
+                            }
+                            return true;
+                        },
+                        [&](auto const& elements) {
+                            return elements == std::get<std::remove_cvref_t<decltype(elements)>>(*other_array.m_storage);
+                        },
+                },
+                *m_storage
+        );
+        return Bool::make(elements_equal, ValueCategory::Rvalue);
+    }
+
+    [[nodiscard]] Array::Storage Array::copy_storage() const {
+        if (auto const boxed = std::get_if<Boxed>(m_storage.get())) {
+            auto elements = Boxed{};
+            elements.reserve(boxed->size());
+            for (auto const& element : *boxed) {
+                // arrays always contain lvalues
+                assert(element->is_lvalue());
+                elements.push_back(element->clone());
             }
+            return elements;
         }
-        return Bool::make(true, ValueCategory::Rvalue);
+        return *m_storage;
     }
 
 } // namespace values
@@ -1,25 +1,45 @@
 #pragma once
 
+#include "bool.hpp"
+#include "char.hpp"
 #include "integer.hpp"
 #include "value.hpp"
+#include <cstdint>
+#include <variant>
 
 namespace values {
 
+    /* Arrays of type [I32], [Char] and [Bool] store their elements unboxed and contiguously
+     * (bools are bit-packed). Lvalues for those elements are only created on demand (see
+     * `ElementReference`). All other arrays store boxed lvalues.
+     * The storage is shared between copies of an array and only gets copied when one of them is
+     * modified (copy-on-write). */
     class Array final : public BasicValue, public std::enable_shared_from_this<Array> {
     public:
-        using ValueType = std::vector<Value>;
+        using Boxed = std::vector<Value>;
+        using Integers = std::vector<Integer::ValueType>;
+        using Chars = std::vector<Char::ValueType>;
+        using Bools = std::vector<bool>;
+        using Storage = std::variant<Boxed, Integers, Chars, Bools>;
 
     private:
-        ValueType m_elements;
+        mutable std::shared_ptr<Storage> m_storage;
+        /* Once an lvalue of a boxed element has been handed out, the storage cannot be shared
+         * anymore, since that lvalue can be used to modify the element. */
+        mutable bool m_is_shareable{ true };
+        std::uint64_t m_generation{ 0 }; // changes whenever existing elements get replaced or moved
 
     public:
-        explicit Array(std::vector<Value> elements, ValueCategory const value_category)
+        Array(Storage storage, ValueCategory const value_category)
+            : Array{ std::make_shared<Storage>(std::move(storage)), value_category } { }
+
+        Array(std::shared_ptr<Storage> storage, ValueCategory const value_category)
             : BasicValue{ value_category },
-              m_elements{ std::move(elements) } { }
+              m_storage{ std::move(storage) } { }
 
-        [[nodiscard]] static Value make(std::vector<Value> elements, ValueCategory const value_category) {
-            return std::make_shared<Array>(std::move(elements), value_category);
-        }
+        /* All elements must be of the same type. Rvalues are promoted to lvalues, lvalues are
+         * copied (but stay lvalues). */
+        [[nodiscard]] static Value make(std::vector<Value> elements, ValueCategory value_category);
 
         [[nodiscard]] bool is_array() const override {
             return true;
@@ -33,105 +53,114 @@ namespace values {
             return *this;
         }
 
-        [[nodiscard]] ValueType const& value() const {
-            return m_elements;
+        [[nodiscard]] std::size_t size() const {
+            return std::visit([](auto const& elements) { return elements.size(); }, *m_storage);
         }
 
-        [[nodiscard]] ValueType& value() {
-            return m_elements;
+        [[nodiscard]] std::uint64_t generation() const {
+            return m_generation;
         }
 
+        // returns an lvalue referring to the element at the given index
+        [[nodiscard]] Value at(std::size_t index) const;
+
+        // returns the value of the element at the given index as an rvalue
+        [[nodiscard]] Value load(std::size_t index) const;
+
+        // overwrites the element at the given index (the value has to be of the element type)
+        void store(std::size_t index, Value const& value);
+
+        void erase(std::size_t index);
+
+        // appends a single value (the value has to be of the element type if the array is not empty)
+        void push(Value const& value);
+
+        // removes the last element and returns it as an rvalue
+        [[nodiscard]] Value pop();
+
+        void reserve(std::size_t capacity);
+
+        [[nodiscard]] std::size_t capacity() const;
+
         [[nodiscard]] std::string string_representation() const override {
             auto result = std::string{ "[" };
-            for (std::size_t i = 0; i < m_elements.size(); ++i) {
-                result += m_elements.at(i)->string_representation();
-                if (i < m_elements.size() - 1) {
+            auto const num_elements = size();
+            for (std::size_t i = 0; i < num_elements; ++i) {
+                result += load(i)->string_representation();
+                if (i < num_elements - 1) {
                     result += ", ";
                 }
             }
             return result + "]";
         }
 
-        [[nodiscard]] types::Type type() const override {
-            if (m_elements.empty()) {
-                return std::make_unique<types::Array>(std::make_unique<types::Unspecified>());
-            }
-            return std::make_unique<types::Array>(m_elements.front()->type());
-        }
+        [[nodiscard]] types::Type type() const override;
 
         [[nodiscard]] Value clone() const override {
-            auto values = std::vector<Value>{};
-            values.reserve(m_elements.size());
-            for (auto const& value : m_elements) {
-                values.push_back(value->clone());
-            }
-            return make(std::move(values), value_category());
+            return make_pooled<Array>(share_storage(), value_category());
         }
 
-        [[nodiscard]] Value binary_plus(Value const& other) const override {
-            if (value().empty()) {
-                return other->as_rvalue();
-            }
-
-            if (other->as_array().value().empty()) {
-                return as_rvalue();
-            }
+        [[nodiscard]] Value binary_plus(Value const& other) const override;
 
-            if (type() != other->type()) {
-                return BasicValue::binary_plus(other); // throws
-            }
-
-            auto values = ValueType{};
-            values.reserve(value().size() + other->as_array().value().size());
-            for (auto const& current : value()) {
-                // arrays always contain lvalues
-                assert(current->is_lvalue());
-                // the new array gets its own copy of the value (but still an lvalue)
-                values.push_back(current->clone());
-            }
-            for (auto const& current : other->as_array().value()) {
-                assert(current->is_lvalue());
-                values.push_back(current->clone());
-            }
-
-            /* The resulting array itself is an rvalue (containing lvalues), so assigning to a
-             * temporary array (e.g. array literal) is possible, but has no effect.
-             * But this has the benefit of not having to recursively promote all values of an
-             * array to lvalues when the value itself becomes an lvalue (e.g. when being assigned
-             * to a variable. */
-            return make(std::move(values), ValueCategory::Rvalue);
+        [[nodiscard]] Value subscript(Value const& index) const override {
+            return at(checked_index(index));
         }
 
-        [[nodiscard]] Value subscript(Value const& index) const override {
-            if (not index->is_integer_value()) {
-                throw UnableToSubscript{ index->type(), type() };
-            }
-            if (index->as_integer_value().value() < 0 or index->as_integer_value().value() >= m_elements.size()) {
-                throw IndexOutOfBounds{ index->as_integer_value().value(),
-                                        static_cast<Integer::ValueType>(m_elements.size()) };
-            }
-            return m_elements.at(index->as_integer_value().value());
+        // like `subscript()`, but returns an rvalue (see `load()`)
+        [[nodiscard]] Value load_subscript(Value const& index) const {
+            return load(checked_index(index));
         }
 
         void assign(Value const& other) override {
             if (not other->is_array()) {
                 BasicValue::assign(other); // throws
             }
-            if (other->as_array().value().empty()) {
+            if (other->as_array().size() == 0) {
                 return;
             }
             /* todo: the type of values contained in an array should not be allowed
          *       to change after it first had some values */
-            m_elements.clear();
-            for (auto const& current : other->as_array().value()) {
-                m_elements.push_back(current->clone());
-                assert(m_elements.back()->is_lvalue());
-            }
+            m_storage = other->as_array().share_storage();
+            m_is_shareable = true;
+            ++m_generation;
         }
 
+        // appends the elements of the other array in place instead of creating a new array
+        void add_assign(Value const& other) override;
+
         [[nodiscard]] Value iterator() override;
         [[nodiscard]] Value member_access(Token member) const override;
         [[nodiscard]] Value equals(Value const& other) const override;
+
+    private:
+        [[nodiscard]] std::size_t checked_index(Value const& index) const {
+            if (not index->is_integer_value()) {
+                throw UnableToSubscript{ index->type(), type() };
+            }
+            if (index->as_integer_value() < 0 or static_cast<std::size_t>(index->as_integer_value()) >= size()) {
+                throw IndexOutOfBounds{ index->as_integer_value(), static_cast<Integer::ValueType>(size()) };
+            }
+            return static_cast<std::size_t>(index->as_integer_value());
+        }
+
+        // boxed elements are copied as well, so that the copy does not share any lvalues with this array
+        [[nodiscard]] Storage copy_storage() const;
+
+        // returns the storage for another array with the same elements
+        [[nodiscard]] std::shared_ptr<Storage> share_storage() const {
+            if (m_is_shareable) {
+                return m_storage;
+            }
+            return std::make_shared<Storage>(copy_storage());
+        }
+
+        // has to be called before modifying the storage (or handing out lvalues of boxed elements)
+        [[nodiscard]] Storage& unique_storage() const {
+            if (m_storage.use_count() > 1) {
+                m_storage = std::make_shared<Storage>(copy_storage());
+            }
+            return *m_storage;
+        }
     };
 
 } // namespace values
@@ -3,7 +3,7 @@
 #include "array.hpp"
 #include "integer.hpp"
 #include "iterator.hpp"
-#include "sentinel.hpp"
+#include <algorithm>
 
 namespace values {
 
@@ -18,16 +18,27 @@ namespace values {
               m_array{ std::move(array) } { }
 
         [[nodiscard]] static Value make(Value array, ValueCategory const value_category) {
-            return std::make_shared<ArrayIterator>(std::move(array), value_category);
+            return make_pooled<ArrayIterator>(std::move(array), value_category);
         }
 
-        [[nodiscard]] Value next() override {
-            if (m_current_index >= m_array->as_array().value().size()) {
-                return Sentinel::make(ValueCategory::Rvalue);
+        [[nodiscard]] std::optional<Value> next() override {
+            if (static_cast<std::size_t>(m_current_index) >= m_array->as_array().size()) {
+                return std::nullopt;
             }
             auto const old_index = m_current_index;
             ++m_current_index;
-            return m_array->as_array().value().at(old_index);
+            return m_array->as_array().at(static_cast<std::size_t>(old_index));
+        }
+
+        std::size_t next_n(std::vector<Value>& out, std::size_t const count) override {
+            auto const& array = m_array->as_array();
+            auto const first = static_cast<std::size_t>(m_current_index);
+            auto const last = first + std::min(count, array.size() - std::min(first, array.size()));
+            for (auto i = first; i < last; ++i) {
+                out.push_back(array.at(i));
+            }
+            m_current_index = static_cast<Integer::ValueType>(last);
+            return last - first;
         }
 
         [[nodiscard]] std::string string_representation() const override {
@@ -35,7 +46,7 @@ namespace values {
                     "ArrayIterator({}, {}/{})",
                     m_array->string_representation(),
                     m_current_index,
-                    m_array->as_array().value().size()
+                    m_array->as_array().size()
             );
         }
 
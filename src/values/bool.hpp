@@ -14,19 +14,22 @@ namespace values {
 
     public:
         explicit Bool(ValueType const value, ValueCategory const value_category)
-            : BasicValue{ value_category },
+            : BasicValue{ value_category, Value::Tag::Bool },
               m_value{ value } { }
 
         [[nodiscard]] static Value make(ValueType const value, ValueCategory const value_category) {
-            return std::make_shared<Bool>(value, value_category);
+            if (value_category == ValueCategory::Rvalue) {
+                return Value{ Value::Tag::Bool, Value::Payload{ .bool_ = value } };
+            }
+            return make_pooled<Bool>(value, value_category);
         }
 
         [[nodiscard]] bool is_bool_value() const override {
             return true;
         }
 
-        [[nodiscard]] Bool const& as_bool_value() const override {
-            return *this;
+        [[nodiscard]] ValueType as_bool_value() const override {
+            return m_value;
         }
 
         [[nodiscard]] std::string string_representation() const override {
@@ -38,13 +41,17 @@ namespace values {
         }
 
         [[nodiscard]] types::Type type() const override {
-            return std::make_unique<types::Bool>();
+            return types::make_bool();
         }
 
         [[nodiscard]] Value clone() const override {
             return make(m_value, value_category());
         }
 
+        [[nodiscard]] Value as_rvalue() const override {
+            return make(m_value, ValueCategory::Rvalue);
+        }
+
         [[nodiscard]] bool value() const {
             return m_value;
         }
@@ -53,14 +60,14 @@ namespace values {
             if (not other->is_bool_value()) {
                 return BasicValue::logical_and(other); // throws
             }
-            return make(value() and other->as_bool_value().value(), ValueCategory::Rvalue);
+            return make(value() and other->as_bool_value(), ValueCategory::Rvalue);
         }
 
         [[nodiscard]] Value logical_or(Value const& other) const override {
             if (not other->is_bool_value()) {
                 return BasicValue::logical_and(other); // throws
             }
-            return make(value() or other->as_bool_value().value(), ValueCategory::Rvalue);
+            return make(value() or other->as_bool_value(), ValueCategory::Rvalue);
         }
 
         [[nodiscard]] Value binary_plus(Value const& other) const override {
@@ -74,14 +81,14 @@ namespace values {
             if (not other->is_bool_value()) {
                 return BasicValue::equals(other); // throws
             }
-            return make(value() == other->as_bool_value().value(), ValueCategory::Rvalue);
+            return make(value() == other->as_bool_value(), ValueCategory::Rvalue);
         }
 
         void assign(Value const& other) override {
             if (not other->is_bool_value()) {
                 BasicValue::assign(other); // throws
             }
-            m_value = other->as_bool_value().value();
+            m_value = other->as_bool_value();
         }
     };
 
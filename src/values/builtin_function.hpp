@@ -1,7 +1,6 @@
 #pragma once
 
 #include "../builtin_function_type.hpp"
-#include "../expressions/expression.hpp"
 #include "array.hpp"
 #include "iterator.hpp"
 #include "nothing.hpp"
@@ -27,7 +26,7 @@ namespace values {
                 BuiltinFunctionType const& type,
                 ValueCategory const value_category
         ) {
-            return std::make_shared<BuiltinFunction>(type, value_category);
+            return make_pooled<BuiltinFunction>(type, value_category);
         }
         // clang-format on
 
@@ -43,62 +42,58 @@ namespace values {
             return make(m_type, value_category());
         }
 
-        // clang-format off
-        [[nodiscard]] Value call(
-            ScopeStack& scope_stack,
-            std::vector<std::unique_ptr<expressions::Expression>> const& arguments
-        ) const override { // clang-format on
+        [[nodiscard]] Value call([[maybe_unused]] ScopeStack& scope_stack, std::vector<Value> const& arguments)
+                const override {
             switch (m_type) {
                 case BuiltinFunctionType::Split:
-                    return split(scope_stack, arguments);
+                    return split(arguments);
                 case BuiltinFunctionType::Join:
-                    return join(scope_stack, arguments);
+                    return join(arguments);
                 case BuiltinFunctionType::Delete:
-                    return delete_(scope_stack, arguments);
+                    return delete_(arguments);
                 case BuiltinFunctionType::Write:
-                    return write(scope_stack, arguments);
+                    return write(arguments);
                 case BuiltinFunctionType::Read:
-                    return read(scope_stack, arguments);
+                    return read(arguments);
                 case BuiltinFunctionType::Trim:
-                    return trim(scope_stack, arguments);
+                    return trim(arguments);
+                case BuiltinFunctionType::Push:
+                    return push(arguments);
+                case BuiltinFunctionType::Pop:
+                    return pop(arguments);
+                case BuiltinFunctionType::Reserve:
+                    return reserve(arguments);
+                case BuiltinFunctionType::Capacity:
+                    return capacity(arguments);
             }
             throw std::runtime_error{ "unreachable" };
         }
 
     private:
-        // clang-format off
-        [[nodiscard]] Value split(
-            ScopeStack& scope_stack,
-            std::vector<std::unique_ptr<expressions::Expression>> const& arguments
-        ) const { // clang-format on
+        [[nodiscard]] Value split(std::vector<Value> const& arguments) const {
             if (arguments.size() < 2) {
                 throw WrongNumberOfArguments{ to_view(m_type), 2, arguments.size() };
             }
             if (arguments.size() > 3) {
                 throw WrongNumberOfArguments{ to_view(m_type), 3, arguments.size() };
             }
-            auto values = std::vector<Value>{};
-            values.reserve(arguments.size());
-            for (auto const& argument : arguments) {
-                values.push_back(argument->evaluate(scope_stack));
-            }
 
-            if (values.front()->is_string_value()) {
-                if (values.size() > 2 and values.at(2)->type() != types::make_bool()) {
-                    throw WrongArgumentType{ to_view(m_type), "discard_empty", values.at(2)->type() };
+            if (arguments.front()->is_string_value()) {
+                if (arguments.size() > 2 and arguments.at(2)->type() != types::make_bool()) {
+                    throw WrongArgumentType{ to_view(m_type), "discard_empty", arguments.at(2)->type() };
                 }
-                auto const discard_empty = values.size() > 2 and values.at(2)->as_bool_value().value();
-                if (values.at(1)->type() == types::make_char()) {
+                auto const discard_empty = arguments.size() > 2 and arguments.at(2)->as_bool_value();
+                if (arguments.at(1)->type() == types::make_char()) {
                     using namespace std::string_literals;
-                    auto const separator = static_cast<char>(values.at(1)->as_char_value().value());
-                    auto const string = values.front()->as_string().string_representation();
+                    auto const separator = static_cast<char>(arguments.at(1)->as_char_value());
+                    auto const& string = arguments.front()->as_string().value();
                     auto current = ""s;
                     auto parts = std::vector<Value>{};
                     for (auto const c : string) {
                         if (c == separator) {
                             if (not discard_empty or not current.empty()) {
                                 parts.push_back(
-                                        String::make(std::string_view{ std::move(current) }, ValueCategory::Lvalue)
+                                        String::make(std::move(current), ValueCategory::Rvalue)
                                 );
                             }
                             current.clear();
@@ -107,46 +102,38 @@ namespace values {
                         current += c;
                     }
                     if (not current.empty()) {
-                        parts.push_back(String::make(std::string_view{ std::move(current) }, ValueCategory::Lvalue));
+                        parts.push_back(String::make(std::move(current), ValueCategory::Rvalue));
                     }
                     return Array::make(std::move(parts), ValueCategory::Rvalue);
                 }
-                throw WrongArgumentType{ to_view(m_type), "separator", values.at(1)->type() };
+                throw WrongArgumentType{ to_view(m_type), "separator", arguments.at(1)->type() };
             }
 
-            throw WrongArgumentType{ to_view(m_type), "splittable", values.front()->type() };
+            throw WrongArgumentType{ to_view(m_type), "splittable", arguments.front()->type() };
         }
 
 
-        // clang-format off
-        [[nodiscard]] Value join(
-            ScopeStack& scope_stack,
-            std::vector<std::unique_ptr<expressions::Expression>> const& arguments
-        ) const { // clang-format on
+        [[nodiscard]] Value join(std::vector<Value> const& arguments) const {
             if (arguments.size() != 2) {
                 throw WrongNumberOfArguments{ to_view(m_type), 2, arguments.size() };
             }
-            auto values = std::vector<Value>{};
-            values.reserve(arguments.size());
-            for (auto const& argument : arguments) {
-                values.push_back(argument->evaluate(scope_stack));
-            }
 
-            if (not values.at(1)->is_string_value() and not values.at(1)->is_char_value()) {
-                throw WrongArgumentType{ to_view(m_type), "separator", values.at(1)->type() };
+            if (not arguments.at(1)->is_string_value() and not arguments.at(1)->is_char_value()) {
+                throw WrongArgumentType{ to_view(m_type), "separator", arguments.at(1)->type() };
             }
 
-            auto const separator = values.at(1)->string_representation();
+            auto const separator = arguments.at(1)->string_representation();
 
-            auto const iterator_value = values.front()->iterator();
+            auto const iterator_value = arguments.front()->iterator();
             auto& iterator = iterator_value->as_iterator();
             auto elements = std::vector<std::string>{};
-            while (true) {
-                auto const next = iterator.next();
-                if (next->is_sentinel()) {
-                    break;
+            auto batch = std::vector<Value>{};
+            static constexpr auto batch_size = std::size_t{ 64 };
+            while (iterator.next_n(batch, batch_size) > 0) {
+                for (auto const& element : batch) {
+                    elements.push_back(element->string_representation());
                 }
-                elements.push_back(next->string_representation());
+                batch.clear();
             }
 
             auto joined = std::string{};
@@ -160,48 +147,39 @@ namespace values {
             return String::make(std::move(joined), ValueCategory::Rvalue);
         }
 
-        // clang-format off
-        [[nodiscard]] Value delete_(
-            ScopeStack& scope_stack,
-            std::vector<std::unique_ptr<expressions::Expression>> const& arguments
-        ) const { // clang-format on
+        [[nodiscard]] Value delete_(std::vector<Value> const& arguments) const {
             if (arguments.size() != 2) {
                 throw WrongNumberOfArguments{ to_view(m_type), 2, arguments.size() };
             }
-            auto values = std::vector<Value>{};
-            values.reserve(arguments.size());
-            for (auto const& argument : arguments) {
-                values.push_back(argument->evaluate(scope_stack));
-            }
 
-            if (not values.front()->is_array() and not values.front()->is_string_value()) {
-                throw WrongArgumentType{ to_view(m_type), "array", values.front()->type() };
+            if (not arguments.front()->is_array() and not arguments.front()->is_string_value()) {
+                throw WrongArgumentType{ to_view(m_type), "array", arguments.front()->type() };
             }
 
-            if (not values.at(1)->is_integer_value()) {
-                throw WrongArgumentType{ to_view(m_type), "index", values.at(1)->type() };
+            if (not arguments.at(1)->is_integer_value()) {
+                throw WrongArgumentType{ to_view(m_type), "index", arguments.at(1)->type() };
             }
 
             auto const container_size = [&] {
-                if (values.front()->is_array()) {
-                    return values.front()->as_array().value().size();
+                if (arguments.front()->is_array()) {
+                    return arguments.front()->as_array().size();
                 }
-                if (values.front()->is_string_value()) {
-                    return values.front()->as_string().length();
+                if (arguments.front()->is_string_value()) {
+                    return arguments.front()->as_string().length();
                 }
                 assert(false and "unreachable");
                 return std::size_t{ 0 };
             }();
 
-            auto const index = values.at(1)->as_integer_value().value();
+            auto const index = arguments.at(1)->as_integer_value();
             if (index < 0 or static_cast<std::size_t>(index) >= container_size) {
                 throw IndexOutOfBounds{ index, static_cast<int>(container_size) };
             }
 
-            if (values.front()->is_array()) {
-                values.front()->as_array().value().erase(std::next(values.front()->as_array().value().begin(), index));
-            } else if (values.front()->is_string_value()) {
-                values.front()->as_string().delete_(index);
+            if (arguments.front()->is_array()) {
+                arguments.front()->as_array().erase(static_cast<std::size_t>(index));
+            } else if (arguments.front()->is_string_value()) {
+                arguments.front()->as_string().delete_(index);
             } else {
                 assert(false and "unreachable");
             }
@@ -209,36 +187,26 @@ namespace values {
             return Nothing::make(ValueCategory::Rvalue);
         }
 
-        // clang-format off
-        [[nodiscard]] Value write(
-            ScopeStack& scope_stack,
-            std::vector<std::unique_ptr<expressions::Expression>> const& arguments
-        ) const {
-            // clang-format on
+        [[nodiscard]] Value write(std::vector<Value> const& arguments) const {
             if (arguments.size() != 2) {
                 throw WrongNumberOfArguments{ to_view(m_type), 2, arguments.size() };
             }
-            auto values = std::vector<Value>{};
-            values.reserve(arguments.size());
-            for (auto const& argument : arguments) {
-                values.push_back(argument->evaluate(scope_stack));
-            }
 
-            if (values.at(0)->type() != types::make_string()) {
-                throw WrongArgumentType{ to_view(m_type), "data", values.at(0)->type() };
+            if (arguments.at(0)->type() != types::make_string()) {
+                throw WrongArgumentType{ to_view(m_type), "data", arguments.at(0)->type() };
             }
 
-            if (values.at(1)->type() != types::make_string()) {
-                throw WrongArgumentType{ to_view(m_type), "filename", values.at(1)->type() };
+            if (arguments.at(1)->type() != types::make_string()) {
+                throw WrongArgumentType{ to_view(m_type), "filename", arguments.at(1)->type() };
             }
 
-            auto file = std::ofstream{ values.at(1)->as_string().string_representation() };
+            auto file = std::ofstream{ arguments.at(1)->as_string().value() };
             if (not file) {
                 // todo: dedicated exception type
                 throw std::runtime_error{ "unable to open file for writing" };
             }
 
-            file << values.at(0)->as_string().string_representation();
+            file << arguments.at(0)->as_string().value();
             if (not file) {
                 // todo: dedicated exception type
                 throw std::runtime_error{ "failed to write file" };
@@ -247,25 +215,16 @@ namespace values {
             return Nothing::make(ValueCategory::Rvalue);
         }
 
-        // clang-format off
-        [[nodiscard]] Value read(
-            ScopeStack& scope_stack,
-            std::vector<std::unique_ptr<expressions::Expression>> const& arguments
-        ) const { // clang-format on
+        [[nodiscard]] Value read(std::vector<Value> const& arguments) const {
             if (arguments.size() != 1) {
                 throw WrongNumberOfArguments{ to_view(m_type), 2, arguments.size() };
             }
-            auto values = std::vector<Value>{};
-            values.reserve(arguments.size());
-            for (auto const& argument : arguments) {
-                values.push_back(argument->evaluate(scope_stack));
-            }
 
-            if (values.at(0)->type() != types::make_string()) {
-                throw WrongArgumentType{ to_view(m_type), "filename", values.at(0)->type() };
+            if (arguments.at(0)->type() != types::make_string()) {
+                throw WrongArgumentType{ to_view(m_type), "filename", arguments.at(0)->type() };
             }
 
-            auto file = std::ifstream{ values.at(0)->as_string().string_representation() };
+            auto file = std::ifstream{ arguments.at(0)->as_string().value() };
             if (not file) {
                 // todo: dedicated exception type
                 throw std::runtime_error{ "unable to open file for reading" };
@@ -280,25 +239,16 @@ namespace values {
             return String::make(stream.str(), ValueCategory::Rvalue);
         }
 
-        [[nodiscard]] Value trim(
-                ScopeStack& scope_stack,
-                std::vector<std::unique_ptr<expressions::Expression>> const& arguments
-        ) const { // clang-format on
+        [[nodiscard]] Value trim(std::vector<Value> const& arguments) const {
             if (arguments.size() != 1) {
                 throw WrongNumberOfArguments{ to_view(m_type), 2, arguments.size() };
             }
 
-            auto values = std::vector<Value>{};
-            values.reserve(arguments.size());
-            for (auto const& argument : arguments) {
-                values.push_back(argument->evaluate(scope_stack));
-            }
-
-            if (values.at(0)->type() != types::make_string()) {
-                throw WrongArgumentType{ to_view(m_type), "to_be_trimmed", values.at(0)->type() };
+            if (arguments.at(0)->type() != types::make_string()) {
+                throw WrongArgumentType{ to_view(m_type), "to_be_trimmed", arguments.at(0)->type() };
             }
 
-            auto string = values.at(0)->as_string().string_representation();
+            auto string = arguments.at(0)->as_string().value();
             auto const left_find_iterator =
                     std::find_if(string.cbegin(), string.cend(), [](char const c) { return not std::isspace(c); });
             if (left_find_iterator == string.cend()) {
@@ -316,6 +266,66 @@ namespace values {
 
             return String::make(std::move(string), ValueCategory::Rvalue);
         }
+
+        [[nodiscard]] Value push(std::vector<Value> const& arguments) const {
+            if (arguments.size() != 2) {
+                throw WrongNumberOfArguments{ to_view(m_type), 2, arguments.size() };
+            }
+
+            if (not arguments.front()->is_array()) {
+                throw WrongArgumentType{ to_view(m_type), "array", arguments.front()->type() };
+            }
+
+            arguments.front()->as_array().push(arguments.at(1));
+            return Nothing::make(ValueCategory::Rvalue);
+        }
+
+        [[nodiscard]] Value pop(std::vector<Value> const& arguments) const {
+            if (arguments.size() != 1) {
+                throw WrongNumberOfArguments{ to_view(m_type), 1, arguments.size() };
+            }
+
+            if (not arguments.front()->is_array()) {
+                throw WrongArgumentType{ to_view(m_type), "array", arguments.front()->type() };
+            }
+
+            return arguments.front()->as_array().pop();
+        }
+
+        [[nodiscard]] Value reserve(std::vector<Value> const& arguments) const {
+            if (arguments.size() != 2) {
+                throw WrongNumberOfArguments{ to_view(m_type), 2, arguments.size() };
+            }
+
+            if (not arguments.front()->is_array()) {
+                throw WrongArgumentType{ to_view(m_type), "array", arguments.front()->type() };
+            }
+
+            if (not arguments.at(1)->is_integer_value()) {
+                throw WrongArgumentType{ to_view(m_type), "capacity", arguments.at(1)->type() };
+            }
+
+            auto const capacity = arguments.at(1)->as_integer_value();
+            if (capacity < 0) {
+                throw NegativeCapacity{ to_view(m_type), capacity };
+            }
+
+            arguments.front()->as_array().reserve(static_cast<std::size_t>(capacity));
+            return Nothing::make(ValueCategory::Rvalue);
+        }
+
+        [[nodiscard]] Value capacity(std::vector<Value> const& arguments) const {
+            if (arguments.size() != 1) {
+                throw WrongNumberOfArguments{ to_view(m_type), 1, arguments.size() };
+            }
+
+            if (not arguments.front()->is_array()) {
+                throw WrongArgumentType{ to_view(m_type), "array", arguments.front()->type() };
+            }
+
+            auto const capacity = arguments.front()->as_array().capacity();
+            return Integer::make(static_cast<Integer::ValueType>(capacity), ValueCategory::Rvalue);
+        }
     };
 
 } // namespace values
@@ -7,16 +7,16 @@ namespace values {
         if (not other->is_char_value()) {
             return BasicValue::equals(other); // throws
         }
-        return Bool::make(value() == other->as_char_value().value(), ValueCategory::Rvalue);
+        return Bool::make(value() == other->as_char_value(), ValueCategory::Rvalue);
     }
 
     [[nodiscard]] Value Char::binary_plus(Value const& other) const {
         if (other->is_integer_value()) {
-            return make(value() + other->as_integer_value().value(), ValueCategory::Rvalue);
+            return make(value() + other->as_integer_value(), ValueCategory::Rvalue);
         }
         if (other->is_string_value()) {
             return String::make(
-                    static_cast<char>(value()) + other->as_string().string_representation(),
+                    static_cast<char>(value()) + other->as_string().value(),
                     ValueCategory::Rvalue
             );
         }
@@ -29,7 +29,7 @@ namespace values {
         }
         return Integer::make(
                 static_cast<Integer::ValueType>(value())
-                        - static_cast<Integer::ValueType>(other->as_char_value().value()),
+                        - static_cast<Integer::ValueType>(other->as_char_value()),
                 ValueCategory::Rvalue
         );
     }
@@ -38,28 +38,28 @@ namespace values {
         if (not other->is_char_value()) {
             return BasicValue::greater_than(other); // throws
         }
-        return Bool::make(value() > other->as_char_value().value(), ValueCategory::Rvalue);
+        return Bool::make(value() > other->as_char_value(), ValueCategory::Rvalue);
     }
 
     [[nodiscard]] Value Char::greater_or_equals(Value const& other) const {
         if (not other->is_char_value()) {
             return BasicValue::greater_or_equals(other); // throws
         }
-        return Bool::make(value() >= other->as_char_value().value(), ValueCategory::Rvalue);
+        return Bool::make(value() >= other->as_char_value(), ValueCategory::Rvalue);
     }
 
     [[nodiscard]] Value Char::less_than(Value const& other) const {
         if (not other->is_char_value()) {
             return BasicValue::less_than(other); // throws
         }
-        return Bool::make(value() < other->as_char_value().value(), ValueCategory::Rvalue);
+        return Bool::make(value() < other->as_char_value(), ValueCategory::Rvalue);
     }
 
     [[nodiscard]] Value Char::less_or_equals(Value const& other) const {
         if (not other->is_char_value()) {
             return BasicValue::less_or_equals(other); // throws
         }
-        return Bool::make(value() <= other->as_char_value().value(), ValueCategory::Rvalue);
+        return Bool::make(value() <= other->as_char_value(), ValueCategory::Rvalue);
     }
 
     void Char::assign(Value const& other) {
@@ -69,6 +69,6 @@ namespace values {
         if (not other->is_char_value()) {
             BasicValue::assign(other); // throw
         }
-        m_value = other->as_char_value().value();
+        m_value = other->as_char_value();
     }
 } // namespace values
@@ -13,11 +13,14 @@ namespace values {
 
     public:
         Char(ValueType const value, ValueCategory const value_category)
-            : BasicValue{ value_category },
+            : BasicValue{ value_category, Value::Tag::Char },
               m_value{ value } { }
 
         [[nodiscard]] static Value make(ValueType const value, ValueCategory const value_category) {
-            return std::make_shared<Char>(value, value_category);
+            if (value_category == ValueCategory::Rvalue) {
+                return Value{ Value::Tag::Char, Value::Payload{ .char_ = value } };
+            }
+            return make_pooled<Char>(value, value_category);
         }
 
         [[nodiscard]] ValueType value() const {
@@ -28,8 +31,8 @@ namespace values {
             return true;
         }
 
-        [[nodiscard]] Char const& as_char_value() const override {
-            return *this;
+        [[nodiscard]] ValueType as_char_value() const override {
+            return m_value;
         }
 
         [[nodiscard]] std::string string_representation() const override {
@@ -44,6 +47,10 @@ namespace values {
             return make(m_value, value_category());
         }
 
+        [[nodiscard]] Value as_rvalue() const override {
+            return make(m_value, ValueCategory::Rvalue);
+        }
+
         [[nodiscard]] Value equals(Value const& other) const override;
 
         [[nodiscard]] Value binary_plus(Value const& other) const override;
@@ -0,0 +1,28 @@
+#include "char_reference.hpp"
+#include "string.hpp"
+
+namespace values {
+    CharReference::CharReference(std::shared_ptr<String> string, std::size_t const index)
+        : m_string{ std::move(string) },
+          m_index{ index },
+          m_generation{ m_string->generation() },
+          m_detached_value{ static_cast<Char::ValueType>(m_string->value().at(index)) } { }
+
+    [[nodiscard]] Value CharReference::as_rvalue() const {
+        if (is_attached()) {
+            m_detached_value = static_cast<Char::ValueType>(m_string->value()[m_index]);
+        }
+        return Char::make(m_detached_value, ValueCategory::Rvalue);
+    }
+
+    void CharReference::store(Value const& value) {
+        m_detached_value = value->as_char_value();
+        if (is_attached()) {
+            m_string->set(m_index, m_detached_value);
+        }
+    }
+
+    [[nodiscard]] bool CharReference::is_attached() const {
+        return m_string->generation() == m_generation;
+    }
+} // namespace values
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "char.hpp"
+#include "reference.hpp"
+#include <cstdint>
+
+namespace values {
+    class String;
+
+    /* A character inside of a string. Once the string gets reassigned or characters get deleted
+     * from it, the reference is detached and continues to live on as a standalone character. */
+    class CharReference final : public Reference {
+    private:
+        std::shared_ptr<String> m_string;
+        std::size_t m_index;
+        std::uint64_t m_generation;
+        mutable Char::ValueType m_detached_value;
+
+    public:
+        CharReference(std::shared_ptr<String> string, std::size_t index);
+
+        [[nodiscard]] static Value make(std::shared_ptr<String> string, std::size_t const index) {
+            return make_pooled<CharReference>(std::move(string), index);
+        }
+
+        [[nodiscard]] Value as_rvalue() const override;
+
+    protected:
+        void store(Value const& value) override;
+
+    private:
+        [[nodiscard]] bool is_attached() const;
+    };
+} // namespace values
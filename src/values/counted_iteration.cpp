@@ -0,0 +1,38 @@
+#include "counted_iteration.hpp"
+#include "array.hpp"
+#include "range.hpp"
+#include "string.hpp"
+
+namespace values {
+
+    [[nodiscard]] bool supports_counted_iteration(Value const& iterable) {
+        return iterable->is_range() or iterable->is_array() or iterable->is_string_value();
+    }
+
+    [[nodiscard]] std::optional<Value> counted_iteration_element(Value const& iterable, std::size_t const index) {
+        assert(supports_counted_iteration(iterable));
+        if (iterable->is_range()) {
+            auto const& range = iterable->as_range();
+            auto const offset = static_cast<std::int64_t>(index);
+            if (offset >= range.length()) {
+                return std::nullopt;
+            }
+            auto const value = static_cast<std::int64_t>(range.first()) + offset * range.step();
+            return Integer::make(static_cast<Integer::ValueType>(value), ValueCategory::Rvalue);
+        }
+        // the size is checked every time, since the loop body may modify the array or string
+        if (iterable->is_array()) {
+            auto const& array = iterable->as_array();
+            if (index >= array.size()) {
+                return std::nullopt;
+            }
+            return array.at(index);
+        }
+        auto const& string = iterable->as_string();
+        if (index >= string.length()) {
+            return std::nullopt;
+        }
+        return string.at(index);
+    }
+
+} // namespace values
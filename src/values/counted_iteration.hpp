@@ -0,0 +1,17 @@
+#pragma once
+
+#include "value.hpp"
+#include <cstddef>
+#include <optional>
+
+namespace values {
+
+    /* Ranges, arrays and strings can be iterated over without creating an iterator object, since
+     * the element with a given index can be determined from the iterable itself. A loop over them
+     * only has to count. */
+    [[nodiscard]] bool supports_counted_iteration(Value const& iterable);
+
+    // returns the element with the given index or `std::nullopt` if the iteration has finished
+    [[nodiscard]] std::optional<Value> counted_iteration_element(Value const& iterable, std::size_t index);
+
+} // namespace values
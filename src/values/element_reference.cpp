@@ -0,0 +1,28 @@
+#include "element_reference.hpp"
+#include "array.hpp"
+
+namespace values {
+    ElementReference::ElementReference(std::shared_ptr<Array> array, std::size_t const index)
+        : m_array{ std::move(array) },
+          m_index{ index },
+          m_generation{ m_array->generation() },
+          m_detached_value{ m_array->load(index) } { }
+
+    [[nodiscard]] Value ElementReference::as_rvalue() const {
+        if (is_attached()) {
+            m_detached_value = m_array->load(m_index);
+        }
+        return m_detached_value;
+    }
+
+    void ElementReference::store(Value const& value) {
+        m_detached_value = value->as_rvalue();
+        if (is_attached()) {
+            m_array->store(m_index, m_detached_value);
+        }
+    }
+
+    [[nodiscard]] bool ElementReference::is_attached() const {
+        return m_array->generation() == m_generation;
+    }
+} // namespace values
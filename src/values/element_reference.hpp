@@ -0,0 +1,33 @@
+#pragma once
+
+#include "reference.hpp"
+#include <cstdint>
+
+namespace values {
+    class Array;
+
+    /* An element of an array with unboxed storage. Once the array gets reassigned or elements get
+     * deleted from it, the reference is detached and continues to live on as a standalone value. */
+    class ElementReference final : public Reference {
+    private:
+        std::shared_ptr<Array> m_array;
+        std::size_t m_index;
+        std::uint64_t m_generation;
+        mutable Value m_detached_value;
+
+    public:
+        ElementReference(std::shared_ptr<Array> array, std::size_t index);
+
+        [[nodiscard]] static Value make(std::shared_ptr<Array> array, std::size_t const index) {
+            return make_pooled<ElementReference>(std::move(array), index);
+        }
+
+        [[nodiscard]] Value as_rvalue() const override;
+
+    protected:
+        void store(Value const& value) override;
+
+    private:
+        [[nodiscard]] bool is_attached() const;
+    };
+} // namespace values
@@ -1,7 +1,6 @@
 #include "function.hpp"
 
 #include "../control_flow.hpp"
-#include "../expressions/expression.hpp"
 #include "../statements/statement.hpp"
 #include "nothing.hpp"
 
@@ -26,48 +25,56 @@ namespace values {
             statements::Statement const* const body,
             ValueCategory const value_category
     ) {
-        return std::make_shared<Function>(name, std::move(parameters), std::move(return_type), body, value_category);
+        return make_pooled<Function>(name, std::move(parameters), std::move(return_type), body, value_category);
     }
 
-    [[nodiscard]] Value Function::call(
-            ScopeStack& scope_stack,
-            std::vector<std::unique_ptr<expressions::Expression>> const& arguments
-    ) const {
+    void Function::bind_arguments(ScopeStack& scope_stack, std::vector<Value> const& arguments) const {
         if (m_parameters.size() != arguments.size()) {
             throw WrongNumberOfArguments{ m_name, m_parameters.size(), arguments.size() };
         }
-        auto const num_scopes = scope_stack.size();
-        auto function_scope = Scope{};
         auto const num_args = arguments.size();
         for (std::size_t i = 0; i < num_args; ++i) {
             auto const& parameter = m_parameters.at(i);
-            auto const& argument_expression = arguments.at(i);
-            auto argument = argument_expression->evaluate(scope_stack);
+            auto const& argument = arguments.at(i);
             if (not parameter.type()->can_be_created_from(argument->type())) {
                 throw WrongArgumentType{ parameter.name(), parameter.type(), argument->type() };
             }
 
-            auto const& [iterator, inserted] =
-                    function_scope.insert({ std::string{ parameter.name().lexeme() }, std::move(argument) });
+            auto const inserted = scope_stack.insert(parameter.name().symbol, argument);
             if (not inserted) {
                 throw SymbolRedefinition{ parameter.name() };
             }
         }
+    }
+
+    void Function::check_return_value(Value const& return_value) const {
+        if (not m_return_type->can_be_created_from(return_value->type())) {
+            throw ReturnTypeMismatch{ m_name.source_location(), m_return_type, return_value->type() };
+        }
+    }
 
-        scope_stack.push(std::move(function_scope));
+    [[nodiscard]] Value Function::call(ScopeStack& scope_stack, std::vector<Value> const& arguments) const {
+        auto const num_scopes = scope_stack.size();
+        scope_stack.push();
+        bind_arguments(scope_stack, arguments);
 
         auto return_value = Nothing::make(ValueCategory::Rvalue);
-        try {
-            m_body->execute(scope_stack);
-        } catch (ReturnException const& e) {
-            auto returned_value = e.value();
-            if (returned_value.has_value()) {
-                return_value = std::move(returned_value.value());
-            }
-        }
-        if (not m_return_type->can_be_created_from(return_value->type())) {
-            throw ReturnTypeMismatch{ m_name.source_location, m_return_type, return_value->type() };
+        auto const completion = m_body->execute(scope_stack);
+        switch (completion.kind()) {
+            case Completion::Kind::Normal:
+                break;
+            case Completion::Kind::Break:
+            case Completion::Kind::Continue:
+                // ends the loop of the caller (if there is one, otherwise this reports the error)
+                scope_stack.truncate(num_scopes);
+                completion.throw_unhandled();
+            case Completion::Kind::Return:
+                if (completion.value().has_value()) {
+                    return_value = completion.value().value()->clone();
+                }
+                break;
         }
+        check_return_value(return_value);
         scope_stack.truncate(num_scopes);
         return return_value;
     }
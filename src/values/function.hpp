@@ -41,10 +41,24 @@ namespace values {
 
         [[nodiscard]] Value clone() const override;
 
-        [[nodiscard]] Value call(
-                ScopeStack& scope_stack,
-                std::vector<std::unique_ptr<expressions::Expression>> const& arguments
-        ) const override;
+        [[nodiscard]] bool is_function() const override {
+            return true;
+        }
+
+        [[nodiscard]] Function const& as_function() const override {
+            return *this;
+        }
+
+        [[nodiscard]] statements::Statement const* body() const {
+            return m_body;
+        }
+
+        // defines the parameters inside the innermost scope of `scope_stack`
+        void bind_arguments(ScopeStack& scope_stack, std::vector<Value> const& arguments) const;
+
+        void check_return_value(Value const& return_value) const;
+
+        [[nodiscard]] Value call(ScopeStack& scope_stack, std::vector<Value> const& arguments) const override;
     };
 
 } // namespace values
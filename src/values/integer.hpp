@@ -17,19 +17,22 @@ namespace values {
 
     public:
         explicit Integer(ValueType const value, ValueCategory const value_category)
-            : BasicValue{ value_category },
+            : BasicValue{ value_category, Value::Tag::Integer },
               m_value{ value } { }
 
-        [[nodiscard]] static Value make(ValueType value, ValueCategory value_category) {
-            return std::make_shared<Integer>(value, value_category);
+        [[nodiscard]] static Value make(ValueType const value, ValueCategory const value_category) {
+            if (value_category == ValueCategory::Rvalue) {
+                return Value{ Value::Tag::Integer, Value::Payload{ .integer = value } };
+            }
+            return make_pooled<Integer>(value, value_category);
         }
 
         [[nodiscard]] bool is_integer_value() const override {
             return true;
         }
 
-        [[nodiscard]] Integer const& as_integer_value() const override {
-            return *this;
+        [[nodiscard]] ValueType as_integer_value() const override {
+            return m_value;
         }
 
         [[nodiscard]] ValueType value() const {
@@ -41,13 +44,17 @@ namespace values {
         }
 
         [[nodiscard]] types::Type type() const noexcept override {
-            return std::make_unique<types::I32>();
+            return types::make_i32();
         }
 
         [[nodiscard]] Value clone() const override {
             return make(m_value, value_category());
         }
 
+        [[nodiscard]] Value as_rvalue() const override {
+            return make(m_value, ValueCategory::Rvalue);
+        }
+
         [[nodiscard]] Value unary_plus() const override {
             return make(m_value, ValueCategory::Rvalue);
         }
@@ -58,7 +65,7 @@ namespace values {
 
         [[nodiscard]] Value binary_plus(Value const& other) const override {
             if (other->is_integer_value()) {
-                return make(value() + other->as_integer_value().value(), ValueCategory::Rvalue);
+                return make(value() + other->as_integer_value(), ValueCategory::Rvalue);
             }
             if (other->is_string_value()) {
                 return String::make(string_representation() + other->string_representation(), ValueCategory::Rvalue);
@@ -68,7 +75,7 @@ namespace values {
 
         [[nodiscard]] Value binary_minus(Value const& other) const override {
             if (other->is_integer_value()) {
-                return make(value() - other->as_integer_value().value(), ValueCategory::Rvalue);
+                return make(value() - other->as_integer_value(), ValueCategory::Rvalue);
             }
             return BasicValue::binary_plus(other); // throws
         }
@@ -77,46 +84,46 @@ namespace values {
             if (not other->is_integer_value()) {
                 return BasicValue::equals(other); // throws
             }
-            return Bool::make(value() == other->as_integer_value().value(), ValueCategory::Rvalue);
+            return Bool::make(value() == other->as_integer_value(), ValueCategory::Rvalue);
         }
 
         [[nodiscard]] Value greater_than(Value const& other) const override {
             if (not other->is_integer_value()) {
                 return BasicValue::equals(other); // throws
             }
-            return Bool::make(value() > other->as_integer_value().value(), ValueCategory::Rvalue);
+            return Bool::make(value() > other->as_integer_value(), ValueCategory::Rvalue);
         }
 
         [[nodiscard]] Value greater_or_equals(Value const& other) const override {
             if (not other->is_integer_value()) {
                 return BasicValue::equals(other); // throws
             }
-            return Bool::make(value() >= other->as_integer_value().value(), ValueCategory::Rvalue);
+            return Bool::make(value() >= other->as_integer_value(), ValueCategory::Rvalue);
         }
 
         [[nodiscard]] Value less_than(Value const& other) const override {
             if (not other->is_integer_value()) {
                 return BasicValue::equals(other); // throws
             }
-            return Bool::make(value() < other->as_integer_value().value(), ValueCategory::Rvalue);
+            return Bool::make(value() < other->as_integer_value(), ValueCategory::Rvalue);
         }
 
         [[nodiscard]] Value less_or_equals(Value const& other) const override {
             if (not other->is_integer_value()) {
                 return BasicValue::equals(other); // throws
             }
-            return Bool::make(value() <= other->as_integer_value().value(), ValueCategory::Rvalue);
+            return Bool::make(value() <= other->as_integer_value(), ValueCategory::Rvalue);
         }
 
         [[nodiscard]] Value multiply(Value const& other) const override {
             if (other->is_integer_value()) {
-                return make(value() * other->as_integer_value().value(), ValueCategory::Rvalue);
+                return make(value() * other->as_integer_value(), ValueCategory::Rvalue);
             }
 
             if (other->is_string_value()) {
                 auto result = std::string{};
                 for (ValueType i = 0; i < value(); ++i) {
-                    result += other->as_string().string_representation();
+                    result += other->as_string().value();
                 }
                 return String::make(std::move(result), ValueCategory::Rvalue);
             }
@@ -128,7 +135,7 @@ namespace values {
             if (not other->is_integer_value()) {
                 return BasicValue::divide(other->clone()); // throws
             }
-            auto const rhs = other->as_integer_value().value();
+            auto const rhs = other->as_integer_value();
             if (rhs == 0) {
                 throw DivisionByZero{};
             }
@@ -139,7 +146,7 @@ namespace values {
             if (not other->is_integer_value()) {
                 return BasicValue::mod(other->clone()); // throws
             }
-            return make(value() % other->as_integer_value().value(), ValueCategory::Rvalue);
+            return make(value() % other->as_integer_value(), ValueCategory::Rvalue);
         }
 
         [[nodiscard]] Value range(Value const& other, bool end_is_inclusive) const override;
@@ -151,7 +158,7 @@ namespace values {
             if (not other->is_integer_value()) {
                 return BasicValue::assign(other->clone()); // throws
             }
-            m_value = other->as_integer_value().value();
+            m_value = other->as_integer_value();
         }
 
         [[nodiscard]] Value cast(types::Type const& target_type) const override;
@@ -1,6 +1,9 @@
 #pragma once
 
 #include "value.hpp"
+#include <cstddef>
+#include <optional>
+#include <vector>
 
 namespace values {
 
@@ -17,7 +20,23 @@ namespace values {
             return *this;
         }
 
-        [[nodiscard]] virtual Value next() = 0;
+        // returns the next element or `std::nullopt` if the iteration has finished
+        [[nodiscard]] virtual std::optional<Value> next() = 0;
+
+        /* Appends up to `count` elements to `out` and returns how many were appended. Less than
+         * `count` elements are only appended if the iteration has finished. */
+        virtual std::size_t next_n(std::vector<Value>& out, std::size_t const count) {
+            auto num_appended = std::size_t{ 0 };
+            while (num_appended < count) {
+                auto value = next();
+                if (not value.has_value()) {
+                    break;
+                }
+                out.push_back(std::move(*value));
+                ++num_appended;
+            }
+            return num_appended;
+        }
     };
 
 } // namespace values
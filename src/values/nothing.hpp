@@ -9,7 +9,10 @@ namespace values {
         using BasicValue::BasicValue;
 
         [[nodiscard]] static Value make(ValueCategory const value_category) {
-            return std::make_shared<Nothing>(value_category);
+            if (value_category == ValueCategory::Rvalue) {
+                return Value{ Value::Tag::Nothing, Value::Payload{} };
+            }
+            return make_pooled<Nothing>(value_category);
         }
 
         [[nodiscard]] std::string string_representation() const override {
@@ -23,6 +26,10 @@ namespace values {
         [[nodiscard]] Value clone() const override {
             return make(value_category());
         }
+
+        [[nodiscard]] Value as_rvalue() const override {
+            return make(ValueCategory::Rvalue);
+        }
     };
 
 } // namespace values
@@ -0,0 +1,72 @@
+#include "pool.hpp"
+#include <array>
+#include <new>
+
+namespace values::pool {
+
+    namespace {
+        constexpr auto max_pooled_size = std::size_t{ 256 };
+        constexpr auto num_size_classes = max_pooled_size / granularity;
+        constexpr auto slab_size = std::size_t{ 64 * 1024 };
+
+        struct FreeBlock final {
+            FreeBlock* next;
+        };
+
+        // trivially destructible, so that values that outlive the thread (e.g. in statics) can still be freed
+        struct State final {
+            std::array<FreeBlock*, num_size_classes> free_lists{};
+            std::byte* slab{ nullptr };
+            std::size_t slab_remaining{ 0 };
+            PoolStatistics statistics;
+        };
+
+        thread_local constinit auto state = State{};
+
+        [[nodiscard]] constexpr std::size_t size_class(std::size_t const size) {
+            return (size + granularity - 1) / granularity - 1;
+        }
+    } // namespace
+
+    [[nodiscard]] void* allocate(std::size_t const size) {
+        ++state.statistics.allocations;
+        if (size > max_pooled_size) {
+            ++state.statistics.oversized_blocks;
+            return ::operator new(size);
+        }
+
+        auto const index = size_class(size);
+        if (auto const block = state.free_lists[index]) {
+            ++state.statistics.reused_blocks;
+            state.free_lists[index] = block->next;
+            return block;
+        }
+
+        auto const block_size = (index + 1) * granularity;
+        if (block_size > state.slab_remaining) {
+            // the rest of the previous slab is abandoned
+            ++state.statistics.slabs;
+            state.slab = static_cast<std::byte*>(::operator new(slab_size));
+            state.slab_remaining = slab_size;
+        }
+        auto const block = state.slab;
+        state.slab += block_size;
+        state.slab_remaining -= block_size;
+        return block;
+    }
+
+    void deallocate(void* const block, std::size_t const size) noexcept {
+        ++state.statistics.deallocations;
+        if (size > max_pooled_size) {
+            ::operator delete(block);
+            return;
+        }
+        auto const index = size_class(size);
+        state.free_lists[index] = ::new (block) FreeBlock{ state.free_lists[index] };
+    }
+
+    [[nodiscard]] PoolStatistics const& statistics() noexcept {
+        return state.statistics;
+    }
+
+} // namespace values::pool
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace values {
+
+    struct PoolStatistics final {
+        std::size_t allocations{ 0 };
+        std::size_t deallocations{ 0 };
+        std::size_t reused_blocks{ 0 };    // allocations served from a free list
+        std::size_t slabs{ 0 };            // number of slabs requested from the global allocator
+        std::size_t oversized_blocks{ 0 }; // allocations too large for any size class
+    };
+
+    /* Size-class pool for runtime values (including the control block of their `shared_ptr`).
+     * Every thread has its own free lists. Freed blocks are kept for reuse and never returned to
+     * the global allocator. */
+    namespace pool {
+        [[nodiscard]] void* allocate(std::size_t size);
+        void deallocate(void* block, std::size_t size) noexcept;
+        [[nodiscard]] PoolStatistics const& statistics() noexcept;
+
+        inline constexpr auto granularity = std::size_t{ 16 };
+    } // namespace pool
+
+    template<typename T>
+    class PoolAllocator final {
+        static_assert(alignof(T) <= pool::granularity);
+
+    public:
+        using value_type = T;
+
+        PoolAllocator() = default;
+
+        template<typename U>
+        PoolAllocator(PoolAllocator<U> const&) noexcept { }
+
+        [[nodiscard]] T* allocate(std::size_t const n) {
+            return static_cast<T*>(pool::allocate(n * sizeof(T)));
+        }
+
+        void deallocate(T* const pointer, std::size_t const n) noexcept {
+            pool::deallocate(pointer, n * sizeof(T));
+        }
+
+        template<typename U>
+        [[nodiscard]] bool operator==(PoolAllocator<U> const&) const noexcept {
+            return true;
+        }
+    };
+
+    // replacement for `std::make_shared` that allocates from the pool
+    template<typename T, typename... Args>
+    [[nodiscard]] std::shared_ptr<T> make_pooled(Args&&... args) {
+        return std::allocate_shared<T>(PoolAllocator<T>{}, std::forward<Args>(args)...);
+    }
+
+} // namespace values
@@ -2,6 +2,7 @@
 
 #include "range_iterator.hpp"
 #include "value.hpp"
+#include <cstdint>
 
 namespace values {
 
@@ -28,7 +29,7 @@ namespace values {
             Value end,
             ValueCategory const value_category
     ) { // clang-format on
-            return std::make_shared<Range>(std::move(start), end_is_inclusive, std::move(end), value_category);
+            return make_pooled<Range>(std::move(start), end_is_inclusive, std::move(end), value_category);
         }
 
         [[nodiscard]] std::string string_representation() const override {
@@ -41,19 +42,44 @@ namespace values {
         }
 
         [[nodiscard]] types::Type type() const override {
-            return std::make_unique<types::Range>();
+            return types::make_range();
         }
 
         [[nodiscard]] Value clone() const override {
             return make(m_start, m_end_is_inclusive, m_end, value_category());
         }
 
+        [[nodiscard]] bool is_range() const override {
+            return true;
+        }
+
+        [[nodiscard]] Range const& as_range() const override {
+            return *this;
+        }
+
+        // the first value produced when iterating over this range
+        [[nodiscard]] Integer::ValueType first() const {
+            return m_start->as_integer_value();
+        }
+
+        // the difference between two consecutive values (1 or -1)
+        [[nodiscard]] Integer::ValueType step() const {
+            return m_start->as_integer_value() > m_end->as_integer_value() ? -1 : 1;
+        }
+
+        // the number of values produced when iterating over this range
+        [[nodiscard]] std::int64_t length() const {
+            auto const start = static_cast<std::int64_t>(m_start->as_integer_value());
+            auto const end = static_cast<std::int64_t>(m_end->as_integer_value());
+            return (start > end ? start - end : end - start) + (m_end_is_inclusive ? 1 : 0);
+        }
+
         [[nodiscard]] Value iterator() override {
             return RangeIterator::make(
                     m_start->as_rvalue(),
                     m_end_is_inclusive,
                     m_end->as_rvalue(),
-                    m_start->as_integer_value().value(),
+                    m_start->as_integer_value(),
                     ValueCategory::Rvalue
             );
         }
@@ -2,7 +2,8 @@
 
 #include "integer.hpp"
 #include "iterator.hpp"
-#include "sentinel.hpp"
+#include <algorithm>
+#include <cstdint>
 
 namespace values {
 
@@ -16,7 +17,7 @@ namespace values {
         Value m_start;
         bool m_end_is_inclusive;
         Value m_end;
-        Integer::ValueType m_current;
+        std::int64_t m_current; // may go past the range of I32 after the last value
         Direction m_direction;
 
     public:
@@ -24,7 +25,7 @@ namespace values {
                 Value const& start,
                 bool const end_is_inclusive,
                 Value const& end,
-                Integer::ValueType current,
+                std::int64_t const current,
                 ValueCategory const value_category
         )
             : Iterator{ value_category },
@@ -35,8 +36,8 @@ namespace values {
             assert(m_start->is_integer_value());
             assert(m_end->is_integer_value());
 
-            auto const start_value = m_start->as_integer_value().value();
-            auto const end_value = m_end->as_integer_value().value();
+            auto const start_value = m_start->as_integer_value();
+            auto const end_value = m_end->as_integer_value();
 
             if (start_value > end_value) {
                 m_direction = Direction::Decreasing;
@@ -50,10 +51,10 @@ namespace values {
             Value start,
             bool const end_is_inclusive,
             Value end,
-            Integer::ValueType current,
+            std::int64_t const current,
             ValueCategory const value_category
     ) { // clang-format on
-            return std::make_shared<RangeIterator>(
+            return make_pooled<RangeIterator>(
                     std::move(start),
                     end_is_inclusive,
                     std::move(end),
@@ -78,9 +79,33 @@ namespace values {
             return *this;
         }
 
-        [[nodiscard]] Value next() override {
+        [[nodiscard]] std::optional<Value> next() override {
+            if (remaining() == 0) {
+                return std::nullopt;
+            }
             auto const current_value = m_current;
-            auto const end_value = m_end->as_integer_value().value();
+            m_current += step();
+            return Integer::make(static_cast<Integer::ValueType>(current_value), ValueCategory::Rvalue);
+        }
+
+        std::size_t next_n(std::vector<Value>& out, std::size_t const count) override {
+            auto const num_values = std::min(static_cast<std::int64_t>(count), remaining());
+            for (auto i = std::int64_t{ 0 }; i < num_values; ++i) {
+                out.push_back(Integer::make(static_cast<Integer::ValueType>(m_current), ValueCategory::Rvalue));
+                m_current += step();
+            }
+            return static_cast<std::size_t>(num_values);
+        }
+
+    private:
+        [[nodiscard]] Integer::ValueType step() const {
+            return m_direction == Direction::Increasing ? 1 : -1;
+        }
+
+        // the number of values that are left (computed with 64 bits, since the bound may not fit into 32 bits)
+        [[nodiscard]] std::int64_t remaining() const {
+            auto const current_value = m_current;
+            auto const end_value = static_cast<std::int64_t>(m_end->as_integer_value());
             // clang-format off
             auto const exclusive_bound = (
                 m_end_is_inclusive ? (
@@ -88,13 +113,9 @@ namespace values {
                 ) : end_value
             );
             // clang-format on
-            if ((m_direction == Direction::Increasing and current_value >= exclusive_bound)
-                or (m_direction == Direction::Decreasing and current_value <= exclusive_bound)) {
-                return Sentinel::make(ValueCategory::Rvalue);
-            }
-            auto const new_value = m_current + (m_direction == Direction::Increasing ? 1 : -1);
-            m_current = new_value;
-            return Integer::make(current_value, ValueCategory::Rvalue);
+            auto const difference =
+                    (m_direction == Direction::Increasing ? exclusive_bound - current_value : current_value - exclusive_bound);
+            return std::max(difference, std::int64_t{ 0 });
         }
     };
 
@@ -0,0 +1,136 @@
+#pragma once
+
+#include "value.hpp"
+
+namespace values {
+
+    /* Base class for lvalues that refer to an element which is stored unboxed inside of another
+     * value (e.g. a character of a string or an integer of an array). These references are only
+     * created on demand. All operations are applied to the current value of the element. */
+    class Reference : public BasicValue {
+    protected:
+        Reference() : BasicValue{ ValueCategory::Lvalue } { }
+
+        // stores a value (of the element type) into the referenced element
+        virtual void store(Value const& value) = 0;
+
+    public:
+        // returns the current value of the referenced element
+        [[nodiscard]] Value as_rvalue() const override = 0;
+
+        [[nodiscard]] std::string string_representation() const override {
+            return as_rvalue()->string_representation();
+        }
+
+        [[nodiscard]] types::Type type() const override {
+            return as_rvalue()->type();
+        }
+
+        // the clone is an independent lvalue that no longer refers to the element
+        [[nodiscard]] Value clone() const override {
+            auto result = as_rvalue();
+            result.promote_to_lvalue();
+            return result;
+        }
+
+        [[nodiscard]] bool is_integer_value() const override {
+            return as_rvalue()->is_integer_value();
+        }
+
+        [[nodiscard]] std::int32_t as_integer_value() const override {
+            return as_rvalue()->as_integer_value();
+        }
+
+        [[nodiscard]] bool is_char_value() const override {
+            return as_rvalue()->is_char_value();
+        }
+
+        [[nodiscard]] std::uint8_t as_char_value() const override {
+            return as_rvalue()->as_char_value();
+        }
+
+        [[nodiscard]] bool is_bool_value() const override {
+            return as_rvalue()->is_bool_value();
+        }
+
+        [[nodiscard]] bool as_bool_value() const override {
+            return as_rvalue()->as_bool_value();
+        }
+
+        [[nodiscard]] Value unary_plus() const override {
+            return as_rvalue()->unary_plus();
+        }
+
+        [[nodiscard]] Value unary_minus() const override {
+            return as_rvalue()->unary_minus();
+        }
+
+        [[nodiscard]] Value binary_plus(Value const& other) const override {
+            return as_rvalue()->binary_plus(other);
+        }
+
+        [[nodiscard]] Value binary_minus(Value const& other) const override {
+            return as_rvalue()->binary_minus(other);
+        }
+
+        [[nodiscard]] Value multiply(Value const& other) const override {
+            return as_rvalue()->multiply(other);
+        }
+
+        [[nodiscard]] Value divide(Value const& other) const override {
+            return as_rvalue()->divide(other);
+        }
+
+        [[nodiscard]] Value equals(Value const& other) const override {
+            return as_rvalue()->equals(other);
+        }
+
+        [[nodiscard]] Value not_equals(Value const& other) const override {
+            return as_rvalue()->not_equals(other);
+        }
+
+        [[nodiscard]] Value greater_than(Value const& other) const override {
+            return as_rvalue()->greater_than(other);
+        }
+
+        [[nodiscard]] Value greater_or_equals(Value const& other) const override {
+            return as_rvalue()->greater_or_equals(other);
+        }
+
+        [[nodiscard]] Value logical_and(Value const& other) const override {
+            return as_rvalue()->logical_and(other);
+        }
+
+        [[nodiscard]] Value logical_or(Value const& other) const override {
+            return as_rvalue()->logical_or(other);
+        }
+
+        [[nodiscard]] Value mod(Value const& other) const override {
+            return as_rvalue()->mod(other);
+        }
+
+        [[nodiscard]] Value less_than(Value const& other) const override {
+            return as_rvalue()->less_than(other);
+        }
+
+        [[nodiscard]] Value less_or_equals(Value const& other) const override {
+            return as_rvalue()->less_or_equals(other);
+        }
+
+        [[nodiscard]] Value range(Value const& other, bool const end_is_inclusive) const override {
+            return as_rvalue()->range(other, end_is_inclusive);
+        }
+
+        [[nodiscard]] Value cast(types::Type const& target_type) const override {
+            return as_rvalue()->cast(target_type);
+        }
+
+        void assign(Value const& other) override {
+            if (other->type() != type()) {
+                BasicValue::assign(other); // throws
+            }
+            store(other);
+        }
+    };
+
+} // namespace values
@@ -1,45 +1,42 @@
 #include "string.hpp"
 #include "bool.hpp"
 #include "char.hpp"
+#include "char_reference.hpp"
 #include "integer.hpp"
 #include "string_iterator.hpp"
 #include <sstream>
 
 namespace values {
 
-    [[nodiscard]] String::ValueType String::to_value_type(std::string_view const value) {
-        auto chars = std::vector<Value>{};
-        chars.reserve(value.length());
-        for (auto const c : value) {
-            chars.push_back(Char::make(c, ValueCategory::Lvalue));
-        }
-        return chars;
+    [[nodiscard]] Value String::at(std::size_t const index) const {
+        assert(index < length());
+        // `String` values are always shared, and the character reference is allowed to modify the string
+        return CharReference::make(std::const_pointer_cast<String>(shared_from_this()), index);
     }
 
     [[nodiscard]] Value String::equals(Value const& other) const {
         if (not other->is_string_value()) {
             return BasicValue::equals(other); // throws
         }
-        return Bool::make(string_representation() == other->string_representation(), ValueCategory::Rvalue);
+        return Bool::make(value() == other->as_string().value(), ValueCategory::Rvalue);
     }
 
     [[nodiscard]] Value String::subscript(Value const& index) const {
         if (not index->is_integer_value()) {
             return BasicValue::subscript(index); // throws
         }
-        auto const index_value = index->as_integer_value().value();
-        if (index_value < 0 or index_value >= m_chars.size()) {
-            throw IndexOutOfBounds{ index_value, static_cast<Integer::ValueType>(m_chars.size()) };
+        auto const index_value = index->as_integer_value();
+        if (index_value < 0 or static_cast<std::size_t>(index_value) >= length()) {
+            throw IndexOutOfBounds{ index_value, static_cast<Integer::ValueType>(length()) };
         }
-        assert(m_chars.at(index_value)->is_lvalue());
-        return m_chars.at(index_value);
+        return at(static_cast<std::size_t>(index_value));
     }
 
     [[nodiscard]] Value String::member_access(Token const member) const {
-        if (member.lexeme() != "size" and member.lexeme() != "length") {
+        if (member.symbol != symbols::size and member.symbol != symbols::length) {
             return BasicValue::member_access(member); // throw
         }
-        return Integer::make(static_cast<Integer::ValueType>(m_chars.size()), ValueCategory::Rvalue);
+        return Integer::make(static_cast<Integer::ValueType>(length()), ValueCategory::Rvalue);
     }
 
     [[nodiscard]] Value String::iterator() {
@@ -48,11 +45,11 @@ namespace values {
 
     [[nodiscard]] Value String::cast(types::Type const& target_type) const {
         if (target_type == types::make_i32()) {
-            auto stream = std::istringstream{ string_representation() };
+            auto stream = std::istringstream{ value() };
             auto value = Integer::ValueType{};
             stream >> value;
             if (not stream or not stream.eof()) {
-                throw CastError{ string_representation(), target_type->to_string() };
+                throw CastError{ this->value(), target_type->to_string() };
             }
             return Integer::make(value, ValueCategory::Rvalue);
         }
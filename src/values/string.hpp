@@ -2,25 +2,30 @@
 
 #include "char.hpp"
 #include "value.hpp"
+#include <cstdint>
+#include <string>
 
 namespace values {
 
+    // The characters are shared between copies of a string and only get copied when one of them is modified.
     class String final : public BasicValue, public std::enable_shared_from_this<String> {
     public:
-        using ValueType = std::vector<Value>;
+        using ValueType = std::string;
 
     private:
-        ValueType m_chars;
-
-        [[nodiscard]] static ValueType to_value_type(std::string_view value);
+        std::shared_ptr<ValueType> m_value;
+        std::uint64_t m_generation{ 0 }; // changes whenever existing characters get replaced or moved
 
     public:
-        explicit String(std::string_view const value, ValueCategory const value_category)
+        explicit String(ValueType value, ValueCategory const value_category)
+            : String{ std::make_shared<ValueType>(std::move(value)), value_category } { }
+
+        String(std::shared_ptr<ValueType> value, ValueCategory const value_category)
             : BasicValue{ value_category },
-              m_chars{ to_value_type(value) } { }
+              m_value{ std::move(value) } { }
 
-        [[nodiscard]] static Value make(std::string_view const value, ValueCategory const value_category) {
-            return std::make_shared<String>(value, value_category);
+        [[nodiscard]] static Value make(ValueType value, ValueCategory const value_category) {
+            return make_pooled<String>(std::move(value), value_category);
         }
 
         [[nodiscard]] bool is_string_value() const override {
@@ -35,34 +40,43 @@ namespace values {
             return *this;
         }
 
-        [[nodiscard]] Value at(std::size_t const index) const {
-            assert(index < m_chars.size());
-            return m_chars.at(index);
+        [[nodiscard]] ValueType const& value() const {
+            return *m_value;
+        }
+
+        [[nodiscard]] std::uint64_t generation() const {
+            return m_generation;
+        }
+
+        // creates an lvalue referring to the character at the given index
+        [[nodiscard]] Value at(std::size_t index) const;
+
+        void set(std::size_t const index, Char::ValueType const c) {
+            assert(index < length());
+            unique_value()[index] = static_cast<char>(c);
         }
 
         [[nodiscard]] std::size_t length() const {
-            return m_chars.size();
+            return m_value->length();
         }
 
         [[nodiscard]] std::string string_representation() const override {
-            auto result = std::string{};
-            for (auto const& c : m_chars) {
-                assert(c->is_char_value());
-                result += static_cast<char>(c->as_char_value().value());
-            }
-            return result;
+            return *m_value;
         }
 
         [[nodiscard]] types::Type type() const noexcept override {
-            return std::make_unique<types::String>();
+            return types::make_string();
         }
 
         [[nodiscard]] Value binary_plus(Value const& other) const override {
-            return make(string_representation() + other->string_representation(), ValueCategory::Rvalue);
+            if (other->is_string_value()) {
+                return make(value() + other->as_string().value(), ValueCategory::Rvalue);
+            }
+            return make(value() + other->string_representation(), ValueCategory::Rvalue);
         }
 
         [[nodiscard]] Value clone() const override {
-            return make(string_representation(), value_category());
+            return make_pooled<String>(m_value, value_category());
         }
 
         [[nodiscard]] Value multiply(Value const& other) const override {
@@ -76,7 +90,8 @@ namespace values {
             if (not other->is_string_value()) {
                 BasicValue::assign(other); // throws
             }
-            m_chars = other->as_string().m_chars;
+            m_value = other->as_string().m_value;
+            ++m_generation;
         }
 
         [[nodiscard]] Value equals(Value const& other) const override;
@@ -90,10 +105,17 @@ namespace values {
         [[nodiscard]] Value cast(types::Type const& target_type) const override;
 
         void delete_(std::size_t const index) {
-            m_chars.erase(std::next(
-                    m_chars.begin(),
-                    static_cast<std::iterator_traits<decltype(m_chars.begin())>::difference_type>(index)
-            ));
+            unique_value().erase(index, 1);
+            ++m_generation;
+        }
+
+    private:
+        // has to be called before modifying the characters
+        [[nodiscard]] ValueType& unique_value() {
+            if (m_value.use_count() > 1) {
+                m_value = std::make_shared<ValueType>(*m_value);
+            }
+            return *m_value;
         }
     };
 
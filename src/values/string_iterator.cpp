@@ -1,13 +1,24 @@
 #include "string_iterator.hpp"
 
-#include "sentinel.hpp"
 #include "string.hpp"
+#include <algorithm>
 
 namespace values {
-    [[nodiscard]] Value StringIterator::next() {
+    [[nodiscard]] std::optional<Value> StringIterator::next() {
         if (m_current_index >= m_string->as_string().length()) {
-            return Sentinel::make(ValueCategory::Rvalue);
+            return std::nullopt;
         }
         return m_string->as_string().at(m_current_index++);
     }
+
+    std::size_t StringIterator::next_n(std::vector<Value>& out, std::size_t const count) {
+        auto const& string = m_string->as_string();
+        auto const first = m_current_index;
+        auto const last = first + std::min(count, string.length() - std::min(first, string.length()));
+        for (auto i = first; i < last; ++i) {
+            out.push_back(string.at(i));
+        }
+        m_current_index = last;
+        return last - first;
+    }
 }
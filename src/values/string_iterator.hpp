@@ -18,7 +18,7 @@ namespace values {
         }
 
         [[nodiscard]] static Value make(Value string, std::size_t current_index, ValueCategory const value_category) {
-            return std::make_shared<StringIterator>(std::move(string), current_index, value_category);
+            return make_pooled<StringIterator>(std::move(string), current_index, value_category);
         }
 
         [[nodiscard]] std::string string_representation() const override {
@@ -38,6 +38,8 @@ namespace values {
             return make(m_string, m_current_index, value_category());
         }
 
-        [[nodiscard]] Value next() override;
+        [[nodiscard]] std::optional<Value> next() override;
+
+        std::size_t next_n(std::vector<Value>& out, std::size_t count) override;
     };
 } // namespace values
@@ -3,17 +3,27 @@
 #include "../statements/struct_definition.hpp"
 #include "bool.hpp"
 #include "value.hpp"
-#include <unordered_map>
+#include <vector>
 
 namespace values {
+    /* The members are stored in the order of the struct definition, so that a member can be accessed
+     * by its index. They are shared between copies of a struct until one of them hands out a member
+     * lvalue. */
     class Struct final : public BasicValue {
+    public:
+        using Members = std::vector<Value>;
+
     private:
         statements::StructDefinition const* m_definition;
-        std::unordered_map<std::string, Value> m_members;
+        mutable std::shared_ptr<Members> m_members;
+        mutable bool m_is_shareable{ true }; // false once a member lvalue has been handed out
 
     public:
+        Struct(statements::StructDefinition const* definition, Members members, ValueCategory const value_category)
+            : Struct{ definition, std::make_shared<Members>(std::move(members)), value_category } { }
+
         Struct(statements::StructDefinition const* definition,
-               std::unordered_map<std::string, Value> members,
+               std::shared_ptr<Members> members,
                ValueCategory const value_category)
             : BasicValue{ value_category },
               m_definition{ definition },
@@ -22,10 +32,10 @@ namespace values {
         // clang-format off
         [[nodiscard]] static Value make(
                 statements::StructDefinition const* definition,
-                std::unordered_map<std::string, Value> members,
+                Members members,
                 ValueCategory const value_category
         ) { // clang-format on
-            return std::make_shared<Struct>(definition, std::move(members), value_category);
+            return make_pooled<Struct>(definition, std::move(members), value_category);
         }
 
         [[nodiscard]] std::string string_representation() const override {
@@ -35,7 +45,7 @@ namespace values {
                 result += std::format(
                         "{}: {}",
                         token.lexeme(),
-                        m_members.at(std::string{ token.lexeme() })->string_representation()
+                        (*m_members)[i]->string_representation()
                 );
                 if (i < m_definition->members().size() - 1) {
                     result += ", ";
@@ -49,12 +59,10 @@ namespace values {
         }
 
         [[nodiscard]] Value clone() const override {
-            auto members_copy = std::unordered_map<std::string, Value>{};
-            members_copy.reserve(m_members.size());
-            for (auto const& [key, value] : m_members) {
-                members_copy.insert({ key, value->clone() });
+            if (m_is_shareable) {
+                return make_pooled<Struct>(m_definition, m_members, value_category());
             }
-            return make(m_definition, std::move(members_copy), value_category());
+            return make(m_definition, copy_members(), value_category());
         }
 
 
@@ -66,6 +74,36 @@ namespace values {
             return *this;
         }
 
+        [[nodiscard]] statements::StructDefinition const* definition() const {
+            return m_definition;
+        }
+
+        // returns an lvalue referring to the member with the given index (see `StructDefinition::member_index()`)
+        [[nodiscard]] Value member(std::size_t const index) const {
+            assert(index < m_members->size());
+            // the returned lvalue can be used to modify the member, so it must not be shared with other structs
+            if (m_members.use_count() > 1) {
+                m_members = std::make_shared<Members>(copy_members());
+            }
+            m_is_shareable = false;
+            return (*m_members)[index];
+        }
+
+        // returns the value of the member with the given index as an rvalue, the members stay shared
+        [[nodiscard]] Value load_member(std::size_t const index) const {
+            assert(index < m_members->size());
+            return (*m_members)[index]->as_rvalue();
+        }
+
+        // like `member_access()`, but returns an rvalue (see `load_member()`)
+        [[nodiscard]] Value load_member(Token const member) const {
+            auto const index = m_definition->member_index(member.symbol);
+            if (not index.has_value()) {
+                return BasicValue::member_access(member); // throws
+            }
+            return load_member(index.value());
+        }
+
         [[nodiscard]] Value equals(Value const& other) const override {
             if (not other->is_struct()) {
                 return BasicValue::equals(other); // throws
@@ -74,8 +112,8 @@ namespace values {
             if (m_definition != other_struct.m_definition) {
                 return BasicValue::equals(other); // throws
             }
-            for (auto const& [name, value] : m_members) {
-                if (not value->equals(other_struct.m_members.at(name))->as_bool_value().value()) {
+            for (auto i = std::size_t{ 0 }; i < m_members->size(); ++i) {
+                if (not (*m_members)[i]->equals((*other_struct.m_members)[i])->as_bool_value()) {
                     return Bool::make(false, ValueCategory::Rvalue);
                 }
             }
@@ -83,12 +121,21 @@ namespace values {
         }
 
         [[nodiscard]] Value member_access(Token const member) const override {
-            auto const find_iterator = m_members.find(std::string{ member.lexeme() });
-            auto const found = (find_iterator != m_members.end());
-            if (not found) {
+            auto const index = m_definition->member_index(member.symbol);
+            if (not index.has_value()) {
                 return BasicValue::member_access(member); // throws
             }
-            return find_iterator->second;
+            return this->member(index.value());
+        }
+
+    private:
+        [[nodiscard]] Members copy_members() const {
+            auto members_copy = Members{};
+            members_copy.reserve(m_members->size());
+            for (auto const& value : *m_members) {
+                members_copy.push_back(value->clone());
+            }
+            return members_copy;
         }
     };
 } // namespace values
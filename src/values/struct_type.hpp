@@ -21,7 +21,7 @@ namespace values {
             statements::StructDefinition const* const definition,
             ValueCategory const value_category
         ) { // clang-format on
-            return std::make_shared<StructType>(definition, value_category);
+            return make_pooled<StructType>(definition, value_category);
         }
 
         [[nodiscard]] ValueType value() const {
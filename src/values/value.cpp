@@ -1,14 +1,15 @@
 #include "value.hpp"
-#include "../expressions/expression.hpp"
 #include "bool.hpp"
+#include "char.hpp"
+#include "integer.hpp"
+#include "nothing.hpp"
 #include "string.hpp"
 
 namespace values {
-    // clang-format off
     [[nodiscard]] Value BasicValue::call(
-            ScopeStack& scope_stack, [[maybe_unused]] std::vector<std::unique_ptr<expressions::Expression>> const&
+            [[maybe_unused]] ScopeStack& scope_stack,
+            [[maybe_unused]] std::vector<Value> const& arguments
     ) const {
-        // clang-format on
         throw OperationNotSupportedByType{ "call", type() };
     }
 
@@ -20,6 +21,271 @@ namespace values {
     }
 
     [[nodiscard]] Value BasicValue::not_equals(Value const& other) const {
-        return Bool::make(not equals(other)->as_bool_value().value(), ValueCategory::Rvalue);
+        return Bool::make(not equals(other)->as_bool_value(), ValueCategory::Rvalue);
+    }
+
+    template<typename Function>
+    decltype(auto) Value::visit(Function&& function) const {
+        switch (m_tag) {
+            case Tag::Boxed:
+                return function(*m_boxed);
+            case Tag::Integer: {
+                auto integer = Integer{ m_payload.integer, ValueCategory::Rvalue };
+                return function(integer);
+            }
+            case Tag::Bool: {
+                auto bool_ = Bool{ m_payload.bool_, ValueCategory::Rvalue };
+                return function(bool_);
+            }
+            case Tag::Char: {
+                auto char_ = Char{ m_payload.char_, ValueCategory::Rvalue };
+                return function(char_);
+            }
+            case Tag::Nothing: {
+                auto nothing = Nothing{ ValueCategory::Rvalue };
+                return function(nothing);
+            }
+        }
+        throw std::runtime_error{ "unreachable" };
+    }
+
+    [[nodiscard]] inline Value::Tag Value::primitive_tag(Payload& payload) const {
+        if (m_tag != Tag::Boxed) {
+            payload = m_payload;
+            return m_tag;
+        }
+        switch (m_boxed->m_primitive_tag) {
+            case Tag::Integer:
+                payload.integer = static_cast<Integer const&>(*m_boxed).value();
+                return Tag::Integer;
+            case Tag::Bool:
+                payload.bool_ = static_cast<Bool const&>(*m_boxed).value();
+                return Tag::Bool;
+            case Tag::Char:
+                payload.char_ = static_cast<Char const&>(*m_boxed).value();
+                return Tag::Char;
+            default:
+                return Tag::Boxed;
+        }
+    }
+
+    [[nodiscard]] inline Value::PrimitiveOperands Value::primitive_operands(Value const& other) const {
+        auto result = PrimitiveOperands{};
+        auto const tag = primitive_tag(result.lhs);
+        result.tag = (tag != Tag::Nothing and other.primitive_tag(result.rhs) == tag) ? tag : Tag::Boxed;
+        return result;
+    }
+
+    void Value::promote_to_lvalue() {
+        switch (m_tag) {
+            case Tag::Boxed:
+                m_boxed->promote_to_lvalue();
+                return;
+            case Tag::Integer:
+                m_boxed = make_pooled<Integer>(m_payload.integer, ValueCategory::Lvalue);
+                break;
+            case Tag::Bool:
+                m_boxed = make_pooled<Bool>(m_payload.bool_, ValueCategory::Lvalue);
+                break;
+            case Tag::Char:
+                m_boxed = make_pooled<Char>(m_payload.char_, ValueCategory::Lvalue);
+                break;
+            case Tag::Nothing:
+                m_boxed = make_pooled<Nothing>(ValueCategory::Lvalue);
+                break;
+        }
+        m_tag = Tag::Boxed;
+    }
+
+    [[nodiscard]] std::string Value::string_representation() const {
+        return visit([](BasicValue const& value) { return value.string_representation(); });
+    }
+
+    [[nodiscard]] types::Type Value::type() const {
+        return visit([](BasicValue const& value) { return value.type(); });
+    }
+
+    /* The arithmetic and comparison operations on I32, Bool and Char values are carried out directly on
+     * the payloads, everything else is forwarded to `BasicValue`. The results have to be exactly those of
+     * the operations of `Integer`, `Bool` and `Char`. */
+
+    [[nodiscard]] Value Value::unary_plus() const {
+        return visit([](BasicValue const& value) { return value.unary_plus(); });
+    }
+
+    [[nodiscard]] Value Value::unary_minus() const {
+        if (auto payload = Payload{}; primitive_tag(payload) == Tag::Integer) {
+            return Integer::make(-payload.integer, ValueCategory::Rvalue);
+        }
+        return visit([](BasicValue const& value) { return value.unary_minus(); });
+    }
+
+    [[nodiscard]] Value Value::binary_plus(Value const& other) const {
+        if (auto const [tag, lhs, rhs] = primitive_operands(other); tag == Tag::Integer) {
+            return Integer::make(lhs.integer + rhs.integer, ValueCategory::Rvalue);
+        }
+        return visit([&](BasicValue const& value) { return value.binary_plus(other); });
+    }
+
+    [[nodiscard]] Value Value::binary_minus(Value const& other) const {
+        switch (auto const [tag, lhs, rhs] = primitive_operands(other); tag) {
+            case Tag::Integer:
+                return Integer::make(lhs.integer - rhs.integer, ValueCategory::Rvalue);
+            case Tag::Char:
+                return Integer::make(
+                        static_cast<Integer::ValueType>(lhs.char_) - static_cast<Integer::ValueType>(rhs.char_),
+                        ValueCategory::Rvalue
+                );
+            default:
+                break;
+        }
+        return visit([&](BasicValue const& value) { return value.binary_minus(other); });
+    }
+
+    [[nodiscard]] Value Value::multiply(Value const& other) const {
+        if (auto const [tag, lhs, rhs] = primitive_operands(other); tag == Tag::Integer) {
+            return Integer::make(lhs.integer * rhs.integer, ValueCategory::Rvalue);
+        }
+        return visit([&](BasicValue const& value) { return value.multiply(other); });
+    }
+
+    [[nodiscard]] Value Value::divide(Value const& other) const {
+        if (auto const [tag, lhs, rhs] = primitive_operands(other); tag == Tag::Integer) {
+            if (rhs.integer == 0) {
+                throw DivisionByZero{};
+            }
+            return Integer::make(lhs.integer / rhs.integer, ValueCategory::Rvalue);
+        }
+        return visit([&](BasicValue const& value) { return value.divide(other); });
+    }
+
+    [[nodiscard]] Value Value::equals(Value const& other) const {
+        switch (auto const [tag, lhs, rhs] = primitive_operands(other); tag) {
+            case Tag::Integer:
+                return Bool::make(lhs.integer == rhs.integer, ValueCategory::Rvalue);
+            case Tag::Bool:
+                return Bool::make(lhs.bool_ == rhs.bool_, ValueCategory::Rvalue);
+            case Tag::Char:
+                return Bool::make(lhs.char_ == rhs.char_, ValueCategory::Rvalue);
+            default:
+                break;
+        }
+        return visit([&](BasicValue const& value) { return value.equals(other); });
+    }
+
+    [[nodiscard]] Value Value::not_equals(Value const& other) const {
+        switch (auto const [tag, lhs, rhs] = primitive_operands(other); tag) {
+            case Tag::Integer:
+                return Bool::make(lhs.integer != rhs.integer, ValueCategory::Rvalue);
+            case Tag::Bool:
+                return Bool::make(lhs.bool_ != rhs.bool_, ValueCategory::Rvalue);
+            case Tag::Char:
+                return Bool::make(lhs.char_ != rhs.char_, ValueCategory::Rvalue);
+            default:
+                break;
+        }
+        return visit([&](BasicValue const& value) { return value.not_equals(other); });
+    }
+
+    [[nodiscard]] Value Value::greater_than(Value const& other) const {
+        switch (auto const [tag, lhs, rhs] = primitive_operands(other); tag) {
+            case Tag::Integer:
+                return Bool::make(lhs.integer > rhs.integer, ValueCategory::Rvalue);
+            case Tag::Char:
+                return Bool::make(lhs.char_ > rhs.char_, ValueCategory::Rvalue);
+            default:
+                break;
+        }
+        return visit([&](BasicValue const& value) { return value.greater_than(other); });
+    }
+
+    [[nodiscard]] Value Value::greater_or_equals(Value const& other) const {
+        switch (auto const [tag, lhs, rhs] = primitive_operands(other); tag) {
+            case Tag::Integer:
+                return Bool::make(lhs.integer >= rhs.integer, ValueCategory::Rvalue);
+            case Tag::Char:
+                return Bool::make(lhs.char_ >= rhs.char_, ValueCategory::Rvalue);
+            default:
+                break;
+        }
+        return visit([&](BasicValue const& value) { return value.greater_or_equals(other); });
+    }
+
+    [[nodiscard]] Value Value::logical_and(Value const& other) const {
+        if (auto const [tag, lhs, rhs] = primitive_operands(other); tag == Tag::Bool) {
+            return Bool::make(lhs.bool_ and rhs.bool_, ValueCategory::Rvalue);
+        }
+        return visit([&](BasicValue const& value) { return value.logical_and(other); });
+    }
+
+    [[nodiscard]] Value Value::logical_or(Value const& other) const {
+        if (auto const [tag, lhs, rhs] = primitive_operands(other); tag == Tag::Bool) {
+            return Bool::make(lhs.bool_ or rhs.bool_, ValueCategory::Rvalue);
+        }
+        return visit([&](BasicValue const& value) { return value.logical_or(other); });
+    }
+
+    [[nodiscard]] Value Value::mod(Value const& other) const {
+        if (auto const [tag, lhs, rhs] = primitive_operands(other); tag == Tag::Integer) {
+            return Integer::make(lhs.integer % rhs.integer, ValueCategory::Rvalue);
+        }
+        return visit([&](BasicValue const& value) { return value.mod(other); });
+    }
+
+    [[nodiscard]] Value Value::less_than(Value const& other) const {
+        switch (auto const [tag, lhs, rhs] = primitive_operands(other); tag) {
+            case Tag::Integer:
+                return Bool::make(lhs.integer < rhs.integer, ValueCategory::Rvalue);
+            case Tag::Char:
+                return Bool::make(lhs.char_ < rhs.char_, ValueCategory::Rvalue);
+            default:
+                break;
+        }
+        return visit([&](BasicValue const& value) { return value.less_than(other); });
+    }
+
+    [[nodiscard]] Value Value::less_or_equals(Value const& other) const {
+        switch (auto const [tag, lhs, rhs] = primitive_operands(other); tag) {
+            case Tag::Integer:
+                return Bool::make(lhs.integer <= rhs.integer, ValueCategory::Rvalue);
+            case Tag::Char:
+                return Bool::make(lhs.char_ <= rhs.char_, ValueCategory::Rvalue);
+            default:
+                break;
+        }
+        return visit([&](BasicValue const& value) { return value.less_or_equals(other); });
+    }
+
+    [[nodiscard]] Value Value::range(Value const& other, bool const end_is_inclusive) const {
+        return visit([&](BasicValue const& value) { return value.range(other, end_is_inclusive); });
+    }
+
+    [[nodiscard]] Value Value::subscript(Value const& index) const {
+        return visit([&](BasicValue const& value) { return value.subscript(index); });
+    }
+
+    void Value::assign(Value const& other) const {
+        // inline values are rvalues, so this only succeeds for boxed values
+        visit([&](BasicValue& value) { value.assign(other); });
+    }
+
+    void Value::add_assign(Value const& other) const {
+        visit([&](BasicValue& value) { value.add_assign(other); });
+    }
+
+    [[nodiscard]] Value Value::iterator() const {
+        return visit([](BasicValue& value) { return value.iterator(); });
+    }
+
+    [[nodiscard]] Value Value::call(ScopeStack& scope_stack, std::vector<Value> const& arguments) const {
+        return visit([&](BasicValue const& value) { return value.call(scope_stack, arguments); });
+    }
+
+    [[nodiscard]] Value Value::member_access(Token const member) const {
+        return visit([&](BasicValue const& value) { return value.member_access(member); });
+    }
+
+    [[nodiscard]] Value Value::cast(types::Type const& target_type) const {
+        return visit([&](BasicValue const& value) { return value.cast(target_type); });
     }
 } // namespace values
@@ -2,48 +2,233 @@
 
 #include "../runtime_error.hpp"
 #include "../types.hpp"
+#include "pool.hpp"
+#include <cassert>
+#include <concepts>
+#include <cstdint>
 #include <format>
 #include <memory>
 #include <stdexcept>
+#include <vector>
 
 namespace values {
     class Struct;
 }
 class ScopeStack;
 
-namespace expressions {
-    class Expression;
-}
-
 namespace values {
     class BasicValue;
-
-    using Value = std::shared_ptr<BasicValue>;
-
     class Integer;
     class Char;
     class String;
     class Bool;
     class Array;
     class Iterator;
+    class Range;
     class StructType;
+    class Function;
+    class Nothing;
 
     enum class ValueCategory {
         Lvalue,
         Rvalue,
     };
 
+    /* A value as it is passed around by the interpreter. Rvalues of type I32, Bool, Char and Nothing
+     * are stored inline and never allocate. Everything else is boxed into a `BasicValue` on the heap.
+     * This includes lvalues of the primitive types, since assignments have to be visible to everyone
+     * referring to the same variable, element or member.
+     * `operator->` yields the `Value` itself, so that the operations of `BasicValue` can be used in the
+     * same way for both representations. */
+    class Value final {
+    private:
+        friend class BasicValue;
+        friend class Integer;
+        friend class Bool;
+        friend class Char;
+        friend class Nothing;
+
+        enum class Tag : std::uint8_t {
+            Boxed,
+            Integer,
+            Bool,
+            Char,
+            Nothing,
+        };
+
+        union Payload {
+            std::int32_t integer;
+            bool bool_;
+            std::uint8_t char_;
+        };
+
+        Tag m_tag;
+        Payload m_payload;
+        std::shared_ptr<BasicValue> m_boxed;
+
+        // the payloads of two operands that are both (inline or boxed) values of the primitive type `tag`
+        struct PrimitiveOperands {
+            Tag tag; // `Tag::Boxed` if the operands are not of the same primitive type
+            Payload lhs;
+            Payload rhs;
+        };
+
+        Value(Tag const tag, Payload const payload) : m_tag{ tag }, m_payload{ payload } { }
+
+        // calls `function` with the boxed value or, for inline values, with a temporary equivalent of it
+        template<typename Function>
+        decltype(auto) visit(Function&& function) const;
+
+        // like `m_tag`, but also looks into boxed values of type I32, Bool and Char
+        [[nodiscard]] Tag primitive_tag(Payload& payload) const;
+
+        [[nodiscard]] PrimitiveOperands primitive_operands(Value const& other) const;
+
+    public:
+        // a default-constructed value is an rvalue of type Nothing
+        Value() : Value{ Tag::Nothing, Payload{} } { }
+
+        template<std::derived_from<BasicValue> T>
+        Value(std::shared_ptr<T> boxed) // NOLINT (implicit conversion is intended)
+            : m_tag{ Tag::Boxed },
+              m_payload{},
+              m_boxed{ std::move(boxed) } { }
+
+        [[nodiscard]] Value const* operator->() const {
+            return this;
+        }
+
+        [[nodiscard]] Value* operator->() {
+            return this;
+        }
+
+        [[nodiscard]] bool is_boxed() const {
+            return m_tag == Tag::Boxed;
+        }
+
+        [[nodiscard]] bool is_lvalue() const;
+
+        [[nodiscard]] bool is_rvalue() const {
+            return not is_lvalue();
+        }
+
+        // inline values are boxed by this, since lvalues need an identity
+        void promote_to_lvalue();
+
+        [[nodiscard]] Value as_rvalue() const;
+
+        [[nodiscard]] std::string string_representation() const;
+
+        [[nodiscard]] types::Type type() const;
+
+        [[nodiscard]] Value clone() const;
+
+        [[nodiscard]] bool is_integer_value() const;
+
+        [[nodiscard]] std::int32_t as_integer_value() const;
+
+        [[nodiscard]] bool is_char_value() const;
+
+        [[nodiscard]] std::uint8_t as_char_value() const;
+
+        [[nodiscard]] bool is_bool_value() const;
+
+        [[nodiscard]] bool as_bool_value() const;
+
+        [[nodiscard]] bool is_string_value() const;
+
+        [[nodiscard]] String& as_string() const;
+
+        [[nodiscard]] bool is_array() const;
+
+        [[nodiscard]] Array& as_array() const;
+
+        [[nodiscard]] bool is_iterator() const;
+
+        [[nodiscard]] Iterator& as_iterator() const;
+
+        [[nodiscard]] bool is_range() const;
+
+        [[nodiscard]] Range const& as_range() const;
+
+        [[nodiscard]] bool is_struct_type() const;
+
+        [[nodiscard]] StructType const& as_struct_type() const;
+
+        [[nodiscard]] bool is_struct() const;
+
+        [[nodiscard]] Struct const& as_struct() const;
+
+        [[nodiscard]] bool is_function() const;
+
+        [[nodiscard]] Function const& as_function() const;
+
+        [[nodiscard]] Value unary_plus() const;
+
+        [[nodiscard]] Value unary_minus() const;
+
+        [[nodiscard]] Value binary_plus(Value const& other) const;
+
+        [[nodiscard]] Value binary_minus(Value const& other) const;
+
+        [[nodiscard]] Value multiply(Value const& other) const;
+
+        [[nodiscard]] Value divide(Value const& other) const;
+
+        [[nodiscard]] Value equals(Value const& other) const;
+
+        [[nodiscard]] Value not_equals(Value const& other) const;
+
+        [[nodiscard]] Value greater_than(Value const& other) const;
+
+        [[nodiscard]] Value greater_or_equals(Value const& other) const;
+
+        [[nodiscard]] Value logical_and(Value const& other) const;
+
+        [[nodiscard]] Value logical_or(Value const& other) const;
+
+        [[nodiscard]] Value mod(Value const& other) const;
+
+        [[nodiscard]] Value less_than(Value const& other) const;
+
+        [[nodiscard]] Value less_or_equals(Value const& other) const;
+
+        [[nodiscard]] Value range(Value const& other, bool end_is_inclusive) const;
+
+        [[nodiscard]] Value subscript(Value const& index) const;
+
+        void assign(Value const& other) const;
+
+        void add_assign(Value const& other) const;
+
+        [[nodiscard]] Value iterator() const;
+
+        [[nodiscard]] Value call(ScopeStack& scope_stack, std::vector<Value> const& arguments) const;
+
+        [[nodiscard]] Value member_access(Token member) const;
+
+        [[nodiscard]] Value cast(types::Type const& target_type) const;
+    };
+
     class BasicValue {
     private:
+        friend class Value;
+
         ValueCategory m_value_category;
+        // allows `Value` to operate on boxed I32, Bool and Char values without calling virtual functions
+        Value::Tag m_primitive_tag;
 
     protected:
         [[nodiscard]] ValueCategory value_category() const {
             return m_value_category;
         }
 
+        BasicValue(ValueCategory const value_category, Value::Tag const primitive_tag)
+            : m_value_category{ value_category },
+              m_primitive_tag{ primitive_tag } { }
+
     public:
-        explicit BasicValue(ValueCategory value_category) : m_value_category{ value_category } { }
+        explicit BasicValue(ValueCategory value_category) : BasicValue{ value_category, Value::Tag::Boxed } { }
 
         virtual ~BasicValue() = default;
 
@@ -59,9 +244,10 @@ namespace values {
             m_value_category = ValueCategory::Lvalue;
         }
 
-        [[nodiscard]] Value as_rvalue() const {
+        [[nodiscard]] virtual Value as_rvalue() const {
             auto cloned = clone();
-            cloned->m_value_category = ValueCategory::Rvalue;
+            assert(cloned.is_boxed());
+            cloned.m_boxed->m_value_category = ValueCategory::Rvalue;
             return cloned;
         }
 
@@ -75,7 +261,7 @@ namespace values {
             return false;
         }
 
-        [[nodiscard]] virtual Integer const& as_integer_value() const {
+        [[nodiscard]] virtual std::int32_t as_integer_value() const {
             throw InvalidValueCast{ "Integer" };
         }
 
@@ -83,7 +269,7 @@ namespace values {
             return false;
         }
 
-        [[nodiscard]] virtual Char const& as_char_value() const {
+        [[nodiscard]] virtual std::uint8_t as_char_value() const {
             throw InvalidValueCast{ "Char" };
         }
 
@@ -103,7 +289,7 @@ namespace values {
             return false;
         }
 
-        [[nodiscard]] virtual Bool const& as_bool_value() const {
+        [[nodiscard]] virtual bool as_bool_value() const {
             throw InvalidValueCast{ "Bool" };
         }
 
@@ -127,10 +313,14 @@ namespace values {
             throw InvalidValueCast{ "Iterator" };
         }
 
-        [[nodiscard]] virtual bool is_sentinel() const {
+        [[nodiscard]] virtual bool is_range() const {
             return false;
         }
 
+        [[nodiscard]] virtual Range const& as_range() const {
+            throw InvalidValueCast{ "Range" };
+        }
+
         [[nodiscard]] virtual bool is_struct_type() const {
             return false;
         }
@@ -147,6 +337,14 @@ namespace values {
             throw InvalidValueCast{ "Struct" };
         }
 
+        [[nodiscard]] virtual bool is_function() const {
+            return false;
+        }
+
+        [[nodiscard]] virtual Function const& as_function() const {
+            throw InvalidValueCast{ "Function" };
+        }
+
         [[nodiscard]] virtual Value unary_plus() const {
             throw OperationNotSupportedByType{ "unary_plus", type() };
         }
@@ -217,16 +415,16 @@ namespace values {
             throw OperationNotSupportedByType{ "assignment", type(), other->type() };
         }
 
+        // implements `+=`, types that can grow in place (e.g. arrays) override this
+        virtual void add_assign(Value const& other) {
+            assign(binary_plus(other));
+        }
+
         [[nodiscard]] virtual Value iterator() {
             throw OperationNotSupportedByType{ "iterator", type() };
         }
 
-        // clang-format off
-        [[nodiscard]] virtual Value call(
-                ScopeStack& scope_stack,
-                [[maybe_unused]] std::vector<std::unique_ptr<expressions::Expression>> const&
-        ) const;
-        // clang-format on
+        [[nodiscard]] virtual Value call(ScopeStack& scope_stack, std::vector<Value> const& arguments) const;
 
         [[nodiscard]] virtual Value member_access(Token const member) const {
             throw NoSuchMember{ type(), member };
@@ -235,4 +433,141 @@ namespace values {
         [[nodiscard]] virtual Value cast(types::Type const& target_type) const;
     };
 
+    [[nodiscard]] inline bool Value::is_lvalue() const {
+        return is_boxed() and m_boxed->is_lvalue();
+    }
+
+    [[nodiscard]] inline Value Value::as_rvalue() const {
+        if (is_boxed()) {
+            return m_boxed->as_rvalue();
+        }
+        return *this;
+    }
+
+    [[nodiscard]] inline Value Value::clone() const {
+        if (is_boxed()) {
+            return m_boxed->clone();
+        }
+        return *this;
+    }
+
+    [[nodiscard]] inline bool Value::is_integer_value() const {
+        return m_tag == Tag::Integer or (is_boxed() and m_boxed->is_integer_value());
+    }
+
+    [[nodiscard]] inline std::int32_t Value::as_integer_value() const {
+        if (m_tag == Tag::Integer) {
+            return m_payload.integer;
+        }
+        if (not is_boxed()) {
+            throw InvalidValueCast{ "Integer" };
+        }
+        return m_boxed->as_integer_value();
+    }
+
+    [[nodiscard]] inline bool Value::is_char_value() const {
+        return m_tag == Tag::Char or (is_boxed() and m_boxed->is_char_value());
+    }
+
+    [[nodiscard]] inline std::uint8_t Value::as_char_value() const {
+        if (m_tag == Tag::Char) {
+            return m_payload.char_;
+        }
+        if (not is_boxed()) {
+            throw InvalidValueCast{ "Char" };
+        }
+        return m_boxed->as_char_value();
+    }
+
+    [[nodiscard]] inline bool Value::is_bool_value() const {
+        return m_tag == Tag::Bool or (is_boxed() and m_boxed->is_bool_value());
+    }
+
+    [[nodiscard]] inline bool Value::as_bool_value() const {
+        if (m_tag == Tag::Bool) {
+            return m_payload.bool_;
+        }
+        if (not is_boxed()) {
+            throw InvalidValueCast{ "Bool" };
+        }
+        return m_boxed->as_bool_value();
+    }
+
+    [[nodiscard]] inline bool Value::is_string_value() const {
+        return is_boxed() and m_boxed->is_string_value();
+    }
+
+    [[nodiscard]] inline String& Value::as_string() const {
+        if (not is_boxed()) {
+            throw InvalidValueCast{ "String" };
+        }
+        return m_boxed->as_string();
+    }
+
+    [[nodiscard]] inline bool Value::is_array() const {
+        return is_boxed() and m_boxed->is_array();
+    }
+
+    [[nodiscard]] inline Array& Value::as_array() const {
+        if (not is_boxed()) {
+            throw InvalidValueCast{ "Array" };
+        }
+        return m_boxed->as_array();
+    }
+
+    [[nodiscard]] inline bool Value::is_iterator() const {
+        return is_boxed() and m_boxed->is_iterator();
+    }
+
+    [[nodiscard]] inline Iterator& Value::as_iterator() const {
+        if (not is_boxed()) {
+            throw InvalidValueCast{ "Iterator" };
+        }
+        return m_boxed->as_iterator();
+    }
+
+    [[nodiscard]] inline bool Value::is_range() const {
+        return is_boxed() and m_boxed->is_range();
+    }
+
+    [[nodiscard]] inline Range const& Value::as_range() const {
+        if (not is_boxed()) {
+            throw InvalidValueCast{ "Range" };
+        }
+        return m_boxed->as_range();
+    }
+
+    [[nodiscard]] inline bool Value::is_struct_type() const {
+        return is_boxed() and m_boxed->is_struct_type();
+    }
+
+    [[nodiscard]] inline StructType const& Value::as_struct_type() const {
+        if (not is_boxed()) {
+            throw InvalidValueCast{ "StructType" };
+        }
+        return m_boxed->as_struct_type();
+    }
+
+    [[nodiscard]] inline bool Value::is_struct() const {
+        return is_boxed() and m_boxed->is_struct();
+    }
+
+    [[nodiscard]] inline Struct const& Value::as_struct() const {
+        if (not is_boxed()) {
+            throw InvalidValueCast{ "Struct" };
+        }
+        return m_boxed->as_struct();
+    }
+
+    [[nodiscard]] inline bool Value::is_function() const {
+        return is_boxed() and m_boxed->is_function();
+    }
+
+    [[nodiscard]] inline Function const& Value::as_function() const {
+        if (not is_boxed()) {
+            throw InvalidValueCast{ "Function" };
+        }
+        return m_boxed->as_function();
+    }
+
 } // namespace values
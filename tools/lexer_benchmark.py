@@ -0,0 +1,69 @@
+import logging
+import os
+import subprocess
+import sys
+import tempfile
+import time
+
+
+def generate_source(num_functions: int) -> str:
+    # functions that are defined but never called, so running the script is dominated by lexing and parsing
+    # (the functions are long, since the time for resolving grows with the number of global names)
+    block_template = """    // block number {block}, generated for the lexer benchmark
+    let some_string_{block} = "the quick brown fox jumps over the lazy dog ({index})";
+    let some_char_{block} = 'x';
+    for current_index in 0..={block} {{
+        if accumulator mod 2 == 0 and current_index != 42 or false {{
+            accumulator = accumulator / 2;
+        }} else {{
+            accumulator += 3 * accumulator + 1;
+        }}
+    }}
+"""
+    num_blocks = 50
+    return "".join(
+        f"function generated_function_{index}(first_argument: I32, second_argument: I32) ~> I32 {{\n"
+        f"    let accumulator = first_argument * 1234567 + second_argument;\n"
+        + "".join(block_template.format(index=index, block=block) for block in range(num_blocks))
+        + "    return accumulator;\n}\n\n"
+        for index in range(num_functions)
+    )
+
+
+def main() -> None:
+    logging.basicConfig(level=logging.INFO)
+
+    if len(sys.argv) < 2:
+        logging.error(f"usage: {sys.argv[0]} <LASZLO EXECUTABLE PATH> [SIZE IN MEGABYTES] [NUMBER OF RUNS]")
+        sys.exit(1)
+
+    laszlo_path = os.path.realpath(sys.argv[1])
+    size_in_megabytes = float(sys.argv[2]) if len(sys.argv) > 2 else 8.0
+    num_runs = int(sys.argv[3]) if len(sys.argv) > 3 else 5
+
+    function_size = len(generate_source(1))
+    source = generate_source(max(1, int(size_in_megabytes * 1024 * 1024 / function_size)))
+
+    with tempfile.TemporaryDirectory() as directory:
+        source_path = os.path.join(directory, "lexer_benchmark.las")
+        with open(source_path, "w") as file:
+            file.write(source)
+
+        durations = []
+        for _ in range(num_runs):
+            start = time.perf_counter()
+            result = subprocess.run([laszlo_path, source_path], stdout=subprocess.DEVNULL, stderr=subprocess.PIPE)
+            durations.append(time.perf_counter() - start)
+            # laszlo reports lexer, parser and runtime errors on stderr, but still exits successfully
+            if result.returncode != 0 or result.stderr:
+                logging.error(f"benchmark run failed (return code {result.returncode}):\n{result.stderr.decode('utf-8')}")
+                sys.exit(1)
+
+    best_duration = min(durations)
+    megabytes = len(source) / (1024 * 1024)
+    logging.info(
+        f"{megabytes:.1f} MiB in {best_duration * 1000:.0f} ms (best of {num_runs} runs), {megabytes / best_duration:.1f} MiB/s")
+
+
+if __name__ == "__main__":
+    main()
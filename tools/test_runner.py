@@ -3,12 +3,24 @@ import logging
 import os
 import subprocess
 import sys
+import tempfile
 from pathlib import Path
 
 
-def run_test(laszlo_path: str, source_path: str, expected_output: str) -> bool:
+def run_test(
+        laszlo_path: str,
+        laszlo_arguments: list[str],
+        source_path: str,
+        expected_output: str,
+        environment: dict[str, str] | None = None,
+) -> bool:
     logging.debug(f"running test for '{source_path}'...")
-    result = subprocess.run([laszlo_path, source_path], stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+    result = subprocess.run(
+        [laszlo_path, *laszlo_arguments, source_path],
+        stdout=subprocess.PIPE,
+        stderr=subprocess.STDOUT,
+        env=environment,
+    )
     return_code = result.returncode
     if return_code != 0:
         logging.error(f"\ntest terminated with unsuccessful return code: return code {return_code}")
@@ -27,15 +39,65 @@ def run_test(laszlo_path: str, source_path: str, expected_output: str) -> bool:
     return True
 
 
+def run_cached_test(laszlo_path: str, laszlo_arguments: list[str], source_path: str, expected_output: str) -> bool:
+    """Runs the test with an empty program cache, then with the image written by that run, and finally
+    with a stale, a corrupted and a truncated image (which have to be ignored and replaced)."""
+    with tempfile.TemporaryDirectory() as cache_directory:
+        environment = {**os.environ, "LASZLO_CACHE_DIR": cache_directory}
+
+        def run() -> bool:
+            return run_test(laszlo_path, laszlo_arguments, source_path, expected_output, environment)
+
+        if not run():
+            return False
+        images = os.listdir(cache_directory)
+        if len(images) != 1:
+            logging.error(f"\nexpected exactly one program image, found {len(images)}")
+            return False
+        image_path = os.path.join(cache_directory, images[0])
+        with open(image_path, "rb") as file:
+            image = file.read()
+
+        # images are replaced atomically (by renaming a new file), so a reused image keeps its inode
+        inode = os.stat(image_path).st_ino
+        if not run():
+            return False
+        if os.stat(image_path).st_ino != inode:
+            logging.error("\nprogram image has not been reused")
+            return False
+
+        # the header starts with the magic number, followed by the key (see program_cache.cpp)
+        stale_image = image[:8] + bytes([image[8] ^ 0xff]) + image[9:]
+        corrupted_image = image[:-1] + bytes([image[-1] ^ 0xff])
+        truncated_image = image[:len(image) // 2]
+        for situation, contents in (
+                ("stale", stale_image),
+                ("corrupted", corrupted_image),
+                ("truncated", truncated_image),
+        ):
+            with open(image_path, "wb") as file:
+                file.write(contents)
+            if not run():
+                return False
+            with open(image_path, "rb") as file:
+                if file.read() != image:
+                    logging.error(f"\n{situation} program image has not been replaced")
+                    return False
+    return True
+
+
 def main() -> None:
     logging.basicConfig(level=logging.DEBUG)
 
-    if len(sys.argv) != 3:
-        logging.error(f"usage: sys{sys.argv[0]} <LASZLO EXECUTABLE PATH> <SOURCES DIRECTORY PATH>")
+    if len(sys.argv) < 3:
+        logging.error(
+            f"usage: sys{sys.argv[0]} <LASZLO EXECUTABLE PATH> <SOURCES DIRECTORY PATH> [LASZLO ARGUMENTS...]")
+        logging.error("(with '--cache', every test also runs with a cached, a stale, a corrupted and a truncated program image)")
         sys.exit(1)
 
     laszlo_path = os.path.realpath(sys.argv[1])
     sources_directory_path = os.path.realpath(Path(sys.argv[2]))
+    laszlo_arguments = sys.argv[3:]
 
     if not os.path.isfile(laszlo_path):
         logging.error(
@@ -67,7 +129,8 @@ def main() -> None:
         with open(expected_output_path) as file:
             expected_output = file.read()
 
-        success = run_test(laszlo_path, canonical_path, expected_output)
+        run = run_cached_test if "--cache" in laszlo_arguments else run_test
+        success = run(laszlo_path, laszlo_arguments, canonical_path, expected_output)
         if not success:
             num_failed += 1
 